@@ -27,7 +27,12 @@
 //****************************************************************************
 // random numbers
 
-static unsigned long seed = 0;
+// per thread, so islands stepped concurrently (CPHWorld::StepIslands) do not race on it
+#ifdef _MSC_VER
+static __declspec(thread) unsigned long seed = 0;
+#else
+static __thread unsigned long seed = 0;
+#endif
 
 unsigned long dRand()
 {
@@ -105,76 +105,17 @@ u64 crc64(void* p, u64 mem_size) {
 	return crc;
 }
 
-void MODEL::build(Fvector* V, int Vcnt, TRI* T, int Tcnt, build_callback* bc, void* bcp)
+bool MODEL::load_cache(Fvector* V, int Vcnt, TRI* T, int Tcnt, string_path& cache_name)
 {
-	auto serialize = [&](pcstr fileName) {
-		IWriter* wstream = FS.w_open(fileName);
-		if(!wstream)
-			return false;
-
-		wstream->w_u32(verts_count);
-		wstream->w(verts, sizeof(Fvector) * verts_count);
-		wstream->w_u32(tris_count);
-		wstream->w(tris, sizeof(TRI) * tris_count);
-
-		if(tree) {
-			tree->Save(wstream);
-		}
-
-		FS.w_close(wstream);
-		return !!tree;
-	};
-
-	auto deserialize = [&](pcstr fileName) {
-		auto rstream = FS.rs_open(0, fileName);
-		if(!rstream)
-			return false;
-
-		CFREE(verts);
-		CFREE(tris);
-		CFREE(tree);
-
-		verts_count = rstream->r_u32();
-		verts = CALLOC(Fvector, verts_count);
-		const u32 vertsSize = verts_count * sizeof(Fvector);
-		rstream->r(verts, vertsSize);
-
-		tris_count = rstream->r_u32();
-		tris = CALLOC(TRI, tris_count);
-		const u32 trisSize = tris_count * sizeof(TRI);
-		rstream->r(tris, trisSize);
-
-		//verts_count = Vcnt;
-		//verts = CALLOC(Fvector, verts_count);
-		//CopyMemory(verts, V, verts_count * sizeof(Fvector));
-
-		//// tris
-		//tris_count = Tcnt;
-		//tris = CALLOC(TRI, tris_count);
-		//CopyMemory(tris, T, tris_count * sizeof(TRI));
-
-		//// callback
-		//if(bc) bc(verts, Vcnt, tris, Tcnt, bcp);
-
-		tree = CNEW(OPCODE_Model)();
-		tree->Load(rstream);
-		FS.r_close(rstream);
-		status = S_READY;
-		return true;
-	};
+	cache_name[0] = 0;
 
 	R_ASSERT(S_INIT == status);
 	R_ASSERT((Vcnt>=4)&&(Tcnt>=2));
 
-	_initialize_cpu_thread();
-
 	static bool disable_cdb_chace = !!strstr(Core.Params, "-no_cdb");
-
 	if(disable_cdb_chace) {
-		build_internal(V, Vcnt, T, Tcnt, bc, bcp);
-		status = S_READY;
-		
-		return;
+		status = S_BUILD;
+		return false;
 	}
 
 	std::string hashed_name = "";
@@ -183,21 +124,84 @@ void MODEL::build(Fvector* V, int Vcnt, TRI* T, int Tcnt, build_callback* bc, vo
 	hashed_name += std::to_string(crc64(V, sizeof(Fvector) * Vcnt)) + "_";
 	hashed_name += std::to_string(crc64(T, sizeof(TRI) * Tcnt));
 
-	string_path fName{};
-	strconcat(sizeof(fName), fName, "cform_cache\\", FS.get_path("$level$")->m_Add, hashed_name.c_str(), ".cdb");
-	FS.update_path(fName, "$app_data_root$", fName);
+	strconcat(sizeof(cache_name), cache_name, "cform_cache\\", FS.get_path("$level$")->m_Add, hashed_name.c_str(), ".cdb");
+	FS.update_path(cache_name, "$app_data_root$", cache_name);
 
-	if(!FS.exist(fName)) {
-		Msg("* ObjectSpace cache for '%s' not found. Building the model from scratch..", fName);
-
-		build_internal(V, Vcnt, T, Tcnt, bc, bcp);
-		status = S_READY;
+	if(!FS.exist(cache_name)) {
+		Msg("* ObjectSpace cache for '%s' not found. Building the model from scratch..", cache_name);
+		status = S_BUILD;
+		return false;
+	}
 
-		serialize(fName);
+	auto rstream = FS.rs_open(0, cache_name);
+	if(!rstream) {
+		status = S_BUILD;
+		return false;
 	}
-	else {
-		deserialize(fName);
+
+	CFREE(verts);
+	CFREE(tris);
+	CFREE(tree);
+
+	verts_count = rstream->r_u32();
+	verts = CALLOC(Fvector, verts_count);
+	const u32 vertsSize = verts_count * sizeof(Fvector);
+	rstream->r(verts, vertsSize);
+
+	tris_count = rstream->r_u32();
+	tris = CALLOC(TRI, tris_count);
+	const u32 trisSize = tris_count * sizeof(TRI);
+	rstream->r(tris, trisSize);
+
+	tree = CNEW(OPCODE_Model)();
+	tree->Load(rstream);
+	FS.r_close(rstream);
+	status = S_READY;
+	return true;
+}
+
+void MODEL::save_cache(LPCSTR cache_name)
+{
+	if(!cache_name[0])
+		return;
+
+	IWriter* wstream = FS.w_open(cache_name);
+	if(!wstream)
+		return;
+
+	wstream->w_u32(verts_count);
+	wstream->w(verts, sizeof(Fvector) * verts_count);
+	wstream->w_u32(tris_count);
+	wstream->w(tris, sizeof(TRI) * tris_count);
+
+	if(tree) {
+		tree->Save(wstream);
 	}
+
+	FS.w_close(wstream);
+}
+
+void MODEL::build_locked(Fvector* V, int Vcnt, TRI* T, int Tcnt, build_callback* bc, void* bcp)
+{
+	_initialize_cpu_thread();
+	cs.Enter();
+	build_internal(V, Vcnt, T, Tcnt, bc, bcp);
+	status = S_READY;
+	cs.Leave();
+}
+
+void MODEL::build(Fvector* V, int Vcnt, TRI* T, int Tcnt, build_callback* bc, void* bcp)
+{
+	_initialize_cpu_thread();
+
+	string_path cache_name;
+	if(load_cache(V, Vcnt, T, Tcnt, cache_name))
+		return;
+
+	build_internal(V, Vcnt, T, Tcnt, bc, bcp);
+	status = S_READY;
+
+	save_cache(cache_name);
 }
 
 void MODEL::build_internal(Fvector* V, int Vcnt, TRI* T, int Tcnt, build_callback* bc, void* bcp)
@@ -98,12 +98,26 @@ namespace CDB
 				xrCriticalSection* C = (xrCriticalSection*)&cs;
 				C->Enter();
 				C->Leave();
+
+				// load_cache() marks a model to be built before build_locked() takes the lock
+				while (S_BUILD == status)
+				{
+					Sleep(0);
+					C->Enter();
+					C->Leave();
+				}
 			}
 		}
 
 		static void build_thread(void*);
 		void build_internal(Fvector* V, int Vcnt, TRI* T, int Tcnt, build_callback* bc = NULL, void* bcp = NULL);
 		void build(Fvector* V, int Vcnt, TRI* T, int Tcnt, build_callback* bc = NULL, void* bcp = NULL);
+
+		// build() in parts: the cache is probed and saved on the thread that owns FS, while
+		// build_locked() may run anywhere; once load_cache() fails queries wait in syncronize()
+		bool load_cache(Fvector* V, int Vcnt, TRI* T, int Tcnt, string_path& cache_name);
+		void build_locked(Fvector* V, int Vcnt, TRI* T, int Tcnt, build_callback* bc = NULL, void* bcp = NULL);
+		void save_cache(LPCSTR cache_name);
 		u32 memory();
 	};
 
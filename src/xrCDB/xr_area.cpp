@@ -18,7 +18,8 @@ using namespace collide;
 // Purpose	: stores space slots
 //----------------------------------------------------------------------
 CObjectSpace::CObjectSpace():
-	xrc()
+	xrc(),
+	m_pending_build(0)
 #ifdef PROFILE_CRITICAL_SECTIONS
 	,Lock(MUTEX_PROFILE_ID(CObjectSpace::Lock))
 #endif // PROFILE_CRITICAL_SECTIONS
@@ -138,6 +139,61 @@ void CObjectSpace::Create(Fvector* verts, CDB::TRI* tris, const hdrCFORM& H, CDB
 	//Sound->set_handler					( _sound_event );
 }
 
+struct CObjectSpace::SPendingBuild
+{
+	IReader* stream;
+	Fvector* verts;
+	CDB::TRI* tris;
+	hdrCFORM header;
+	CDB::build_callback* build_callback;
+	string_path cache_name;
+	bool built;
+};
+
+bool CObjectSpace::Open(CDB::build_callback build_callback)
+{
+	VERIFY(!m_pending_build);
+	SPendingBuild* pending = xr_new<SPendingBuild>();
+	pending->stream = FS.r_open("$level$", "level.cform");
+	R_ASSERT(pending->stream);
+	pending->stream->r(&pending->header, sizeof(hdrCFORM));
+	pending->verts = (Fvector*)pending->stream->pointer();
+	pending->tris = (CDB::TRI*)(pending->verts + pending->header.vertcount);
+	pending->build_callback = build_callback;
+	pending->built = false;
+	m_pending_build = pending;
+
+	const hdrCFORM& H = pending->header;
+	R_ASSERT(CFORM_CURRENT_VERSION==H.version);
+	m_BoundingVolume.set(H.aabb);
+	g_SpatialSpace->initialize(m_BoundingVolume);
+	g_SpatialSpacePhysic->initialize(m_BoundingVolume);
+
+	return !Static.load_cache(pending->verts, H.vertcount, pending->tris, H.facecount, pending->cache_name);
+}
+
+void CObjectSpace::Build()
+{
+	SPendingBuild* pending = m_pending_build;
+	VERIFY(pending);
+	Static.build_locked(pending->verts, pending->header.vertcount, pending->tris, pending->header.facecount,
+	                    pending->build_callback);
+	pending->built = true;
+}
+
+void CObjectSpace::Close()
+{
+	SPendingBuild* pending = m_pending_build;
+	VERIFY(pending);
+	m_pending_build = 0;
+
+	if (pending->built)
+		Static.save_cache(pending->cache_name);
+
+	FS.r_close(pending->stream);
+	xr_delete(pending);
+}
+
 //----------------------------------------------------------------------
 #ifdef DEBUG
 void CObjectSpace::dbgRender()
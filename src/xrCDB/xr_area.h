@@ -30,6 +30,9 @@ private:
 	xrXRC xrc; // MT: dangerous
 	collide::rq_results r_temp; // MT: dangerous
 	xr_vector<ISpatial*> r_spatial; // MT: dangerous
+
+	struct SPendingBuild;
+	SPendingBuild* m_pending_build;
 public:
 
 #ifdef DEBUG
@@ -58,6 +61,12 @@ public:
 	void Load(LPCSTR path, LPCSTR fname, CDB::build_callback build_callback);
 	void Load(IReader* R, CDB::build_callback build_callback);
 	void Create(Fvector* verts, CDB::TRI* tris, const hdrCFORM& H, CDB::build_callback build_callback);
+
+	// Load split for the level loading pipeline: Open reads the file, sets up the spatial DBs and
+	// tries the cform cache, Build makes the tree and may run on a worker, Close saves the cache
+	bool Open(CDB::build_callback build_callback); // true when Build is needed
+	void Build();
+	void Close();
 	// Occluded/No
 	BOOL RayTest(const Fvector& start, const Fvector& dir, float range, collide::rq_target tgt,
 	             collide::ray_cache* cache, CObject* ignore_object);
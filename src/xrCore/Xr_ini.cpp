@@ -15,8 +15,6 @@
 XRCORE_API CInifile const* pSettings = NULL;
 XRCORE_API CInifile const* pSettingsAuth = NULL;
 
-//#define INICACHE_PRINT_DEBUG
-
 CInifile* CInifile::Create(const char* szFileName, BOOL ReadOnly)
 {
 	return xr_new<CInifile>(szFileName, ReadOnly);
@@ -121,6 +119,8 @@ CInifile::CInifile(IReader* F, LPCSTR path
 )
 {
 	m_file_name[0] = 0;
+	m_indexed_sections = 0;
+	m_dependencies = NULL;
 	m_flags.zero();
 	m_flags.set(eSaveAtEnd, FALSE);
 	m_flags.set(eReadOnly, TRUE);
@@ -130,6 +130,7 @@ CInifile::CInifile(IReader* F, LPCSTR path
 	     , allow_include_func
 #endif
 	);
+	build_index();
 }
 
 CInifile::CInifile(LPCSTR szFileName,
@@ -147,6 +148,8 @@ CInifile::CInifile(LPCSTR szFileName,
 		Msg("-----loading %s", szFileName);
 
 	m_file_name[0] = 0;
+	m_indexed_sections = 0;
+	m_dependencies = NULL;
 	m_flags.zero();
 	if (szFileName)
 		xr_strcpy(m_file_name, sizeof(m_file_name), szFileName);
@@ -156,6 +159,14 @@ CInifile::CInifile(LPCSTR szFileName,
 
 	if (bLoad)
 	{
+#ifndef _EDITOR
+		bool snapshot = szFileName && ReadOnly && !allow_include_func && !strstr(Core.Params, "-no_ltx_snapshot");
+#else
+		bool snapshot = false;
+#endif
+		if (snapshot && load_snapshot())
+			return;
+
 		string_path path, folder;
 		_splitpath(m_file_name, path, folder, 0, 0);
 		xr_strcat(path, sizeof(path), folder);
@@ -164,13 +175,20 @@ CInifile::CInifile(LPCSTR szFileName,
 		{
 			if (sect_count)
 				DATA.reserve(sect_count);
+			if (snapshot)
+				begin_snapshot();
 			Load(R, path
 #ifndef _EDITOR
 			     , allow_include_func
 #endif
 			);
 			FS.r_close(R);
+			if (snapshot)
+				end_snapshot();
 		}
+
+		if (ReadOnly)
+			build_index();
 	}
 }
 
@@ -348,6 +366,7 @@ void CInifile::Load(IReader* F, LPCSTR path
 			{
 				IReader* I = FS.r_open(_fn);
 				R_ASSERT3(I, "Can't find include file:", name);
+				track_file(_fn);
 
 				strcpy(currentFileName, name);
 
@@ -422,10 +441,12 @@ void CInifile::Load(IReader* F, LPCSTR path
 				//Collect all files that could potentially be confused as a root file by our mod files
 				FS_FileSet AmbiguousFiles;
 				FS.file_list(AmbiguousFiles, FilePath.c_str(), FS_ListFiles, (FileName + "_*.ltx").c_str());
+				track_list(FilePath.c_str(), (FileName + "_*.ltx").c_str());
 
 				//Collect all matching mod files
 				FS_FileSet ModFiles;
 				FS.file_list(ModFiles, FilePath.c_str(), FS_ListFiles, ("mod_" + FileName + "_*.ltx").c_str());
+				track_list(FilePath.c_str(), ("mod_" + FileName + "_*.ltx").c_str());
 
 				for (auto It = ModFiles.begin(); It != ModFiles.end(); ++It)
 				{
@@ -523,6 +544,7 @@ void CInifile::Load(IReader* F, LPCSTR path
 					{
 						FS_FileSet fset;
 						FS.file_list(fset, inc_path, FS_ListFiles, inc_name);
+						track_list(inc_path, inc_name);
 
 						for (FS_FileSet::iterator it = fset.begin(); it != fset.end(); it++)
 						{
@@ -1130,37 +1152,103 @@ bool CInifile::save_as(LPCSTR new_fname)
 	return (true);
 }
 
-BOOL CInifile::section_exist(LPCSTR S) const
+void CInifile::index_section(Sect* section, u64 hash)
 {
-	if (S && m_cache.find(S) != m_cache.end()) {
-#ifdef INICACHE_PRINT_DEBUG
-		Msg("[%s] section_exist: found section %s in cache", m_file_name, S);
-#endif // INICACHE_PRINT_DEBUG
-		return TRUE;
+	std::pair<SectionIndex::iterator, bool> result = m_section_index.insert(std::make_pair(hash, section));
+	if (!result.second)
+		result.first->second = NULL; // collision, resolved by the sorted search
+}
+
+void CInifile::index_line(const Item* item, u64 hash)
+{
+	std::pair<LineIndex::iterator, bool> result = m_line_index.insert(std::make_pair(hash, item));
+	if (!result.second)
+		result.first->second = NULL;
+}
+
+void CInifile::build_index()
+{
+	m_section_index.clear();
+	m_line_index.clear();
+	m_indexed_sections = 0;
+
+	if (!m_flags.test(eReadOnly))
+		return;
+
+	u32 line_count = 0;
+	for (RootCIt I = DATA.begin(); I != DATA.end(); ++I)
+		line_count += (*I)->Data.size();
+
+	m_section_index.reserve(DATA.size());
+	m_line_index.reserve(line_count);
+
+	for (RootCIt I = DATA.begin(); I != DATA.end(); ++I)
+	{
+		u64 hash = name_hash(*(*I)->Name);
+		index_section(*I, hash);
+
+		for (SectCIt J = (*I)->Data.begin(); J != (*I)->Data.end(); ++J)
+			if (*J->first)
+				index_line(&*J, line_hash(hash, *J->first));
 	}
-	RootCIt I = std::lower_bound(DATA.begin(), DATA.end(), S, sect_pred);
-	return (I != DATA.end() && xr_strcmp(*(*I)->Name, S) == 0);
+
+	m_indexed_sections = DATA.size();
 }
 
-BOOL CInifile::line_exist(LPCSTR S, LPCSTR L) const
+CInifile::Sect* CInifile::find_section(LPCSTR S) const
 {
-	if (!section_exist(S)) return FALSE;
+	if (S && index_valid())
+	{
+		SectionIndex::const_iterator I = m_section_index.find(name_hash(S));
+		if (I == m_section_index.end())
+			return NULL;
 
-	if (S && L) {
-		auto cacheSec = m_cache.find(S);
-		if (cacheSec != m_cache.end() && cacheSec->second.find(L) != cacheSec->second.end()) {
+		if (I->second)
+			return (xr_strcmp(*I->second->Name, S) == 0 ? I->second : NULL);
+	}
 
-#ifdef INICACHE_PRINT_DEBUG
-			Msg("[%s] line_exist: found section %s line %s in cache", m_file_name, S, L);
-#endif // INICACHE_PRINT_DEBUG
+	RootCIt I = std::lower_bound(DATA.begin(), DATA.end(), S, sect_pred);
+	return ((I != DATA.end() && xr_strcmp(*(*I)->Name, S) == 0) ? *I : NULL);
+}
 
-			return TRUE;
+const CInifile::Item* CInifile::find_line(LPCSTR S, LPCSTR L) const
+{
+	if (S && L && index_valid())
+	{
+		LineIndex::const_iterator I = m_line_index.find(line_hash(name_hash(S), L));
+		if (I == m_line_index.end())
+			return NULL;
+
+		if (I->second)
+		{
+			if (xr_strcmp(*I->second->first, L) != 0)
+				return NULL;
+
+			// the line may be found under the other section with the same hash
+			Sect* section = find_section(S);
+			if (section && !section->Data.empty() &&
+				I->second >= &section->Data.front() && I->second <= &section->Data.back())
+				return I->second;
+			return NULL;
 		}
 	}
 
-	Sect& I = r_section(S);
-	SectCIt A = std::lower_bound(I.Data.begin(), I.Data.end(), L, item_pred);
-	return (A != I.Data.end() && xr_strcmp(*A->first, L) == 0);
+	Sect* section = find_section(S);
+	if (!section)
+		return NULL;
+
+	SectCIt A = std::lower_bound(section->Data.begin(), section->Data.end(), L, item_pred);
+	return ((A != section->Data.end() && xr_strcmp(*A->first, L) == 0) ? &*A : NULL);
+}
+
+BOOL CInifile::section_exist(LPCSTR S) const
+{
+	return (find_section(S) != NULL);
+}
+
+BOOL CInifile::line_exist(LPCSTR S, LPCSTR L) const
+{
+	return (find_line(S, L) != NULL);
 }
 
 u32 CInifile::line_count(LPCSTR Sname) const
@@ -1196,8 +1284,8 @@ CInifile::Sect& CInifile::r_section(LPCSTR S) const
 	char section[256];
 	xr_strcpy(section, sizeof(section), S);
 	strlwr(section);
-	RootCIt I = std::lower_bound(DATA.begin(), DATA.end(), section, sect_pred);
-	if (!(I != DATA.end() && xr_strcmp(*(*I)->Name, section) == 0))
+	Sect* result = find_section(section);
+	if (!result)
 	{
 		//g_pStringContainer->verify();
 
@@ -1213,20 +1301,7 @@ CInifile::Sect& CInifile::r_section(LPCSTR S) const
 
 		Debug.fatal(DEBUG_INFO, "Can't open section '%s'. Please attach [*.ini_log] file to your bug report", S);
 	}
-	return **I;
-}
-
-void CInifile::cacheValue(LPCSTR S, LPCSTR L, shared_str& V) {
-	if (S && L) {
-
-#ifdef INICACHE_PRINT_DEBUG
-		Msg("[%s] cacheValue: writing [%s] %s = %s in cache", m_file_name, S, L, V.c_str());
-#endif // INICACHE_PRINT_DEBUG
-
-		std::string s = S;
-		std::string l = L;
-		m_cache[s][l] = V;
-	}
+	return *result;
 }
 
 LPCSTR CInifile::r_string(LPCSTR S, LPCSTR L) const
@@ -1236,32 +1311,15 @@ LPCSTR CInifile::r_string(LPCSTR S, LPCSTR L) const
 		Msg("!![ERROR] CInifile::r_string: S = [%s], L = [%s]", S, L);
 	}
 	
-	if (S && L) {
-		std::string s = S;
-		std::string l = L;
-		auto sectKey = m_cache.find(s);
-		if (sectKey != m_cache.end()) {
-			auto lineKey = sectKey->second.find(l);
-			if (lineKey != sectKey->second.end()) {
-				auto& res = lineKey->second;
-
-#ifdef INICACHE_PRINT_DEBUG
-				Msg("[%s] r_string: getting [%s] %s = %s in cache", m_file_name, S, L, res.c_str());
-#endif // INICACHE_PRINT_DEBUG
-
-				return *res;
-			}
-		}
-	}
+	const Item* line = find_line(S, L);
+	if (line)
+		return *line->second;
 
+	// r_section also accepts the section name in upper case
 	Sect const& I = r_section(S);
 	SectCIt A = std::lower_bound(I.Data.begin(), I.Data.end(), L, item_pred);
-	if (A != I.Data.end() && xr_strcmp(*A->first, L) == 0) {
-		shared_str V = A->second;
-		LPCSTR res = *V;
-		const_cast<CInifile*>(this)->cacheValue(S, L, V);
-		return res;
-	}
+	if (A != I.Data.end() && xr_strcmp(*A->first, L) == 0)
+		return *A->second;
 	else
 		Debug.fatal(DEBUG_INFO, "Can't find variable %s in [%s]", L, S);
 	return 0;
@@ -1463,6 +1521,7 @@ BOOL CInifile::r_line(const shared_str& S, int L, const char** N, const char** V
 void CInifile::w_string(LPCSTR S, LPCSTR L, LPCSTR V, LPCSTR comment)
 {
 	R_ASSERT(!m_flags.test(eReadOnly));
+	m_indexed_sections = 0;
 
 	// section
 	string256 sect;
@@ -1513,9 +1572,6 @@ void CInifile::w_string(LPCSTR S, LPCSTR L, LPCSTR V, LPCSTR comment)
 	{
 		data.Data.insert(it, I);
 	}
-
-	cacheValue(sect, I.first.c_str(), I.second);
-	
 }
 
 void CInifile::w_u8(LPCSTR S, LPCSTR L, u8 V, LPCSTR comment)
@@ -1653,6 +1709,7 @@ void CInifile::w_bool(LPCSTR S, LPCSTR L, BOOL V, LPCSTR comment)
 void CInifile::remove_line(LPCSTR S, LPCSTR L)
 {
 	R_ASSERT(!m_flags.test(eReadOnly));
+	m_indexed_sections = 0;
 
 	if (line_exist(S, L))
 	{
@@ -1660,13 +1717,5 @@ void CInifile::remove_line(LPCSTR S, LPCSTR L)
 		SectIt_ A = std::lower_bound(data.Data.begin(), data.Data.end(), L, item_pred);
 		R_ASSERT(A != data.Data.end() && xr_strcmp(*A->first, L) == 0);
 		data.Data.erase(A);
-
-#ifdef INICACHE_PRINT_DEBUG
-		Msg("[%s] remove_line: removing [%s] %s from cache", m_file_name, S, L);
-#endif // INICACHE_PRINT_DEBUG
-
-		std::string s = S;
-		std::string l = L;
-		m_cache[s].erase(l);
 	}
 }
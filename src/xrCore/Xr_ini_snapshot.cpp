@@ -0,0 +1,369 @@
+#include "stdafx.h"
+#pragma hdrstop
+
+#include "fs_internal.h"
+
+// Compiled LTX snapshots.
+// A read-only CInifile is saved after its first parse together with the list of files it was
+// assembled from (root, #include, DLTX mods) and the listings of the folders scanned for wildcard
+// includes and mods. Next time the snapshot is used as is while every file keeps its size, time
+// and crc and every listing returns the same names; otherwise the text is parsed again and the
+// snapshot is rewritten. -no_ltx_snapshot disables both. The body is followed by its crc and the
+// magic again; a snapshot that is cut short, damaged or does not add up is a miss as well.
+
+static const u32 snapshot_magic = MAKEFOURCC('L', 'T', 'X', 'S');
+static const u32 snapshot_version = 3;
+static const u32 snapshot_null = u32(-1);
+
+// bounds checked reads over the snapshot body
+struct SnapshotReader
+{
+	const u8* pos;
+	const u8* end;
+
+	u32 elapsed() const { return u32(end - pos); }
+
+	bool r_u32(u32& value)
+	{
+		if (elapsed() < sizeof(value))
+			return false;
+		CopyMemory(&value, pos, sizeof(value));
+		pos += sizeof(value);
+		return true;
+	}
+
+	bool r_u64(u64& value)
+	{
+		if (elapsed() < sizeof(value))
+			return false;
+		CopyMemory(&value, pos, sizeof(value));
+		pos += sizeof(value);
+		return true;
+	}
+
+	bool r_stringZ(LPCSTR& value)
+	{
+		const u8* term = (const u8*)memchr(pos, 0, elapsed());
+		if (!term)
+			return false;
+		value = (LPCSTR)pos;
+		pos = term + 1;
+		return true;
+	}
+
+	// a count of records that take at least record_size bytes each
+	bool r_count(u32& value, u32 record_size)
+	{
+		return r_u32(value) && value <= elapsed() / record_size;
+	}
+};
+
+struct CInifile::Dependencies
+{
+	struct File
+	{
+		shared_str name;
+		u32 size;
+		u32 modif;
+		u32 crc;
+	};
+
+	struct Listing
+	{
+		shared_str path;
+		shared_str mask;
+		u32 crc;
+	};
+
+	xr_vector<File> files;
+	xr_vector<Listing> listings;
+};
+
+static bool describe_file(LPCSTR file_name, u32& size, u32& modif, u32& crc)
+{
+	string_path name;
+	xr_strcpy(name, file_name);
+	xr_strlwr(name);
+
+	const CLocatorAPI::file* desc = FS.exist(name);
+	if (!desc)
+		return false;
+
+	size = desc->size_real;
+	modif = desc->modif;
+	crc = desc->crc;
+	return true;
+}
+
+static u32 listing_crc(LPCSTR path, LPCSTR mask)
+{
+	FS_FileSet files;
+	FS.file_list(files, path, FS_ListFiles, mask);
+
+	u32 crc = 0;
+	for (FS_FileSet::const_iterator I = files.begin(); I != files.end(); ++I)
+	{
+		crc = crc32(I->name.c_str(), I->name.size() + 1, crc);
+		crc = crc32(&I->size, sizeof(I->size), crc);
+		u32 time = u32(I->time_write);
+		crc = crc32(&time, sizeof(time), crc);
+	}
+	return crc;
+}
+
+void CInifile::snapshot_name(string_path& result) const
+{
+	string_path file_name, ext;
+	_splitpath(m_file_name, 0, 0, file_name, ext);
+
+	string_path lower;
+	xr_strcpy(lower, m_file_name);
+	xr_strlwr(lower);
+
+	string_path name;
+	xr_sprintf(name, "ltx_cache\\%s%s_%08x.ltxc", file_name, ext, path_crc32(lower, xr_strlen(lower)));
+	FS.update_path(result, "$app_data_root$", name);
+}
+
+void CInifile::begin_snapshot()
+{
+	if (!FS.path_exist("$app_data_root$"))
+		return;
+
+	m_dependencies = xr_new<Dependencies>();
+	track_file(m_file_name);
+}
+
+void CInifile::track_file(LPCSTR file_name)
+{
+	if (!m_dependencies)
+		return;
+
+	Dependencies::File file;
+	if (!describe_file(file_name, file.size, file.modif, file.crc))
+		return;
+
+	file.name = file_name;
+	m_dependencies->files.push_back(file);
+}
+
+void CInifile::track_list(LPCSTR path, LPCSTR mask)
+{
+	if (!m_dependencies)
+		return;
+
+	Dependencies::Listing listing;
+	listing.path = path;
+	listing.mask = mask;
+	listing.crc = listing_crc(path, mask);
+	m_dependencies->listings.push_back(listing);
+}
+
+void CInifile::end_snapshot()
+{
+	Dependencies* deps = m_dependencies;
+	m_dependencies = NULL;
+	if (!deps)
+		return;
+
+	// a file without includes and mods parses faster than the snapshot checks its listings
+	if (deps->files.size() < 2)
+	{
+		xr_delete(deps);
+		return;
+	}
+
+	typedef xr_unordered_map<LPCSTR, u32> StringIds;
+	StringIds ids;
+	xr_vector<LPCSTR> strings;
+
+	auto string_id = [&](const shared_str& value) -> u32
+	{
+		if (!*value)
+			return snapshot_null;
+
+		std::pair<StringIds::iterator, bool> result = ids.insert(std::make_pair(*value, u32(strings.size())));
+		if (result.second)
+			strings.push_back(*value);
+		return result.first->second;
+	};
+
+	CMemoryWriter W;
+	W.w_u32(snapshot_magic);
+	W.w_u32(snapshot_version);
+
+	W.w_u32(deps->files.size());
+	for (xr_vector<Dependencies::File>::const_iterator I = deps->files.begin(); I != deps->files.end(); ++I)
+	{
+		W.w_stringZ(I->name);
+		W.w_u32(I->size);
+		W.w_u32(I->modif);
+		W.w_u32(I->crc);
+	}
+
+	W.w_u32(deps->listings.size());
+	for (xr_vector<Dependencies::Listing>::const_iterator I = deps->listings.begin(); I != deps->listings.end(); ++I)
+	{
+		W.w_stringZ(I->path);
+		W.w_stringZ(I->mask);
+		W.w_u32(I->crc);
+	}
+	xr_delete(deps);
+
+	// sections go to a separate stream, they have to follow the string table
+	CMemoryWriter S;
+	S.w_u32(DATA.size());
+	for (RootCIt I = DATA.begin(); I != DATA.end(); ++I)
+	{
+		u64 hash = name_hash(*(*I)->Name);
+		S.w_u32(string_id((*I)->Name));
+		S.w_u64(hash);
+		S.w_u32((*I)->Data.size());
+
+		for (SectCIt J = (*I)->Data.begin(); J != (*I)->Data.end(); ++J)
+		{
+			S.w_u32(string_id(J->first));
+			S.w_u32(string_id(J->second));
+			S.w_u32(string_id(J->filename));
+			S.w_u64(*J->first ? line_hash(hash, *J->first) : 0);
+		}
+	}
+
+	W.w_u32(strings.size());
+	for (xr_vector<LPCSTR>::const_iterator I = strings.begin(); I != strings.end(); ++I)
+		W.w_stringZ(*I);
+	W.w(S.pointer(), S.size());
+
+	// the crc covers everything between the header and itself
+	W.w_u32(crc32(W.pointer() + 2 * sizeof(u32), W.size() - 2 * sizeof(u32)));
+	W.w_u32(snapshot_magic);
+
+	string_path file_name;
+	snapshot_name(file_name);
+	if (!W.save_to(file_name))
+		Msg("! Can't write ltx snapshot [%s]", file_name);
+}
+
+bool CInifile::load_snapshot()
+{
+	string_path file_name;
+	if (!FS.path_exist("$app_data_root$"))
+		return false;
+
+	snapshot_name(file_name);
+	if (GetFileAttributes(file_name) == INVALID_FILE_ATTRIBUTES)
+		return false;
+
+	IReader* F = xr_new<CVirtualFileReader>(file_name);
+	const u8* data = (const u8*)F->pointer();
+	u32 length = F->length();
+
+	// header, body, crc of the body, trailing magic
+	bool result = length >= 4 * sizeof(u32)
+		&& *(const u32*)data == snapshot_magic
+		&& *(const u32*)(data + sizeof(u32)) == snapshot_version
+		&& *(const u32*)(data + length - sizeof(u32)) == snapshot_magic
+		&& *(const u32*)(data + length - 2 * sizeof(u32)) == crc32(data + 2 * sizeof(u32), length - 4 * sizeof(u32));
+
+	SnapshotReader R;
+	R.pos = data + 2 * sizeof(u32);
+	R.end = data + (result ? length - 2 * sizeof(u32) : 2 * sizeof(u32));
+
+	u32 count = 0;
+	result = result && R.r_count(count, 1 + 3 * sizeof(u32));
+	for (u32 i = 0; result && i < count; ++i)
+	{
+		LPCSTR name;
+		u32 size, modif, crc;
+		result = R.r_stringZ(name) && R.r_u32(size) && R.r_u32(modif) && R.r_u32(crc);
+
+		u32 current_size, current_modif, current_crc;
+		result = result && describe_file(name, current_size, current_modif, current_crc)
+			&& current_size == size && current_modif == modif && current_crc == crc;
+	}
+
+	result = result && R.r_count(count, 2 + sizeof(u32));
+	for (u32 i = 0; result && i < count; ++i)
+	{
+		LPCSTR path, mask;
+		u32 crc;
+		result = R.r_stringZ(path) && R.r_stringZ(mask) && R.r_u32(crc) && listing_crc(path, mask) == crc;
+	}
+
+	xr_vector<shared_str> strings;
+	result = result && R.r_count(count, 1);
+	if (result)
+		strings.resize(count);
+	for (xr_vector<shared_str>::iterator I = strings.begin(); result && I != strings.end(); ++I)
+	{
+		LPCSTR value;
+		result = R.r_stringZ(value);
+		if (result)
+			*I = value;
+	}
+
+	auto string_at = [&](u32 id, shared_str& value) -> bool
+	{
+		if (id == snapshot_null)
+			return true;
+		if (id >= strings.size())
+			return false;
+		value = strings[id];
+		return true;
+	};
+
+	const u32 line_size = 3 * sizeof(u32) + sizeof(u64);
+	u32 section_count = 0;
+	result = result && R.r_count(section_count, 2 * sizeof(u32) + sizeof(u64));
+	if (result)
+	{
+		DATA.reserve(section_count);
+		m_section_index.reserve(section_count);
+		m_line_index.reserve(R.elapsed() / line_size);
+	}
+
+	for (u32 i = 0; result && i < section_count; ++i)
+	{
+		// it goes to DATA right away, so a failure below frees it with the rest
+		Sect* section = xr_new<Sect>();
+		DATA.push_back(section);
+
+		u32 name, line_count;
+		u64 hash;
+		result = R.r_u32(name) && string_at(name, section->Name) && R.r_u64(hash) && R.r_count(line_count, line_size);
+		if (!result)
+			break;
+
+		section->Data.resize(line_count);
+		for (SectIt_ J = section->Data.begin(); result && J != section->Data.end(); ++J)
+		{
+			u32 first, second, filename;
+			u64 line;
+			result = R.r_u32(first) && R.r_u32(second) && R.r_u32(filename) && R.r_u64(line)
+				&& string_at(first, J->first) && string_at(second, J->second) && string_at(filename, J->filename);
+
+			if (result && *J->first)
+				index_line(&*J, line);
+		}
+
+		// sections come sorted, the same order Load left them in
+		index_section(section, hash);
+	}
+
+	result = result && !R.elapsed();
+
+	if (result)
+		m_indexed_sections = DATA.size();
+	else
+	{
+		// the caller parses the text instead
+		for (RootIt I = DATA.begin(); I != DATA.end(); ++I)
+			xr_delete(*I);
+		DATA.clear();
+		m_section_index.clear();
+		m_line_index.clear();
+	}
+
+	xr_delete(F);
+	return result;
+}
@@ -347,6 +347,7 @@ void thread_name(const char* name)
 	tn.szName = name;
 	tn.dwThreadID = DWORD(-1);
 	tn.dwFlags = 0;
+	xr_trace::set_thread_name(name);
 	__try
 	{
 		RaiseException(0x406D1388, 0, sizeof(tn) / sizeof(DWORD), (ULONG_PTR *)&tn);
@@ -293,5 +293,7 @@ XRCORE_API char* timestamp(string64& dest);
 extern XRCORE_API u32 crc32(const void* P, u32 len);
 extern XRCORE_API u32 crc32(const void* P, u32 len, u32 starting_crc);
 extern XRCORE_API u32 path_crc32(const char* path, u32 len); // ignores '/' and '\'
+extern XRCORE_API u64 hash64(const void* P, u32 len, u64 seed = 0); // xxHash64, not a checksum
+extern XRCORE_API void _hash_benchmark(u32 size); // checks and times the crc32 paths, 0 - a set of sizes
 
 #endif // _STD_EXT_internal
@@ -1,8 +1,23 @@
 #include "stdafx.h"
 #pragma hdrstop
 
+#include <intrin.h>
+#include <emmintrin.h>
+#include <smmintrin.h>
+#include <wmmintrin.h>
+
+// crc32 values are stored in archives, saves, spawn and net digests and shared strings, so the
+// result must stay the same PKZip/Ethernet CRC-32 on every CPU. Buffers go 8 bytes per step through
+// sliced tables, and blocks of 64 bytes and more are folded with carry-less multiplication where
+// the CPU has PCLMULQDQ. The SSE4.2 crc32 instruction computes CRC-32C, a different polynomial,
+// and is not used.
+
 static BOOL crc32_ready = FALSE;
-static u32 crc32_table[256]; // Lookup table array
+static BOOL crc32_clmul = FALSE;
+static u32 crc32_table[8][256]; // Lookup tables, [0] is the classic bytewise one
+
+// the folding starts with four full 16 byte lanes, it is already ~5x faster than the tables there
+static const u32 crc32_clmul_min = 64;
 
 inline u32 Reflect(u32 ref, char ch) // Reflects CRC bits in the lookup table
 {
@@ -21,6 +36,13 @@ inline u32 Reflect(u32 ref, char ch) // Reflects CRC bits in the lookup table
 	return value;
 }
 
+static bool crc32_clmul_supported()
+{
+	int info[4];
+	__cpuid(info, 1);
+	return (info[2] & (1 << 1)) && (info[2] & (1 << 19)); // PCLMULQDQ, SSE4.1
+}
+
 void crc32_init()
 {
 	// Call this function only once to initialize the CRC table.
@@ -32,67 +54,177 @@ void crc32_init()
 	// 256 values representing ASCII character codes.
 	for (int i = 0; i <= 0xFF; i++)
 	{
-		crc32_table[i] = Reflect(i, 8) << 24;
+		crc32_table[0][i] = Reflect(i, 8) << 24;
 		for (int j = 0; j < 8; j++)
-			crc32_table[i] = (crc32_table[i] << 1) ^ (crc32_table[i] & (1 << 31) ? ulPolynomial : 0);
-		crc32_table[i] = Reflect(crc32_table[i], 32);
+			crc32_table[0][i] = (crc32_table[0][i] << 1) ^ (crc32_table[0][i] & (1 << 31) ? ulPolynomial : 0);
+		crc32_table[0][i] = Reflect(crc32_table[0][i], 32);
 	}
+
+	// table k advances a byte through k more zero bytes
+	for (int k = 1; k < 8; k++)
+		for (int i = 0; i <= 0xFF; i++)
+			crc32_table[k][i] = (crc32_table[k - 1][i] >> 8) ^ crc32_table[0][crc32_table[k - 1][i] & 0xFF];
+
+	crc32_clmul = crc32_clmul_supported();
 }
 
-u32 crc32(const void* P, u32 len)
+IC void crc32_check_init()
 {
 	if (!crc32_ready)
 	{
 		crc32_init();
 		crc32_ready = TRUE;
 	}
+}
+
+static u32 crc32_bytewise(u32 crc, const u8* buffer, u32 len)
+{
+	while (len--)
+		crc = (crc >> 8) ^ crc32_table[0][(crc & 0xFF) ^ *buffer++];
+	return crc;
+}
+
+static u32 crc32_sliced(u32 crc, const u8* buffer, u32 len)
+{
+	for (; len && (size_t(buffer) & 7); --len)
+		crc = (crc >> 8) ^ crc32_table[0][(crc & 0xFF) ^ *buffer++];
+
+	for (; len >= 8; len -= 8, buffer += 8)
+	{
+		u32 one = *(const u32*)buffer ^ crc;
+		u32 two = *(const u32*)(buffer + 4);
+		crc = crc32_table[7][one & 0xFF] ^
+			crc32_table[6][(one >> 8) & 0xFF] ^
+			crc32_table[5][(one >> 16) & 0xFF] ^
+			crc32_table[4][one >> 24] ^
+			crc32_table[3][two & 0xFF] ^
+			crc32_table[2][(two >> 8) & 0xFF] ^
+			crc32_table[1][(two >> 16) & 0xFF] ^
+			crc32_table[0][two >> 24];
+	}
+
+	return crc32_bytewise(crc, buffer, len);
+}
 
-	// Pass a text string to this function and it will return the CRC.
+// Folds 64 bytes per step into four 128-bit lanes, then the lanes into one and reduces it to 32 bits
+// (Intel, "Fast CRC Computation for Generic Polynomials Using PCLMULQDQ Instruction"). Takes the
+// running crc register, len is a multiple of 16 and at least 64.
+static u32 crc32_folded(u32 crc, const u8* buffer, u32 len)
+{
+	static const __declspec(align(16)) u64 k1k2[2] = {0x0154442bd4ull, 0x01c6e41596ull};
+	static const __declspec(align(16)) u64 k3k4[2] = {0x01751997d0ull, 0x00ccaa009eull};
+	static const __declspec(align(16)) u64 k5k0[2] = {0x0163cd6124ull, 0x0000000000ull};
+	static const __declspec(align(16)) u64 poly[2] = {0x01db710641ull, 0x01f7011641ull};
 
-	// Once the lookup table has been filled in by the two functions above,
-	// this function creates all CRCs using only the lookup table.
+	__m128i x0, x1, x2, x3, x4, x5, x6, x7, x8;
 
-	// Be sure to use unsigned variables,
-	// because negative values introduce high bits
-	// where zero bits are required.
+	x1 = _mm_loadu_si128((const __m128i*)(buffer + 0x00));
+	x2 = _mm_loadu_si128((const __m128i*)(buffer + 0x10));
+	x3 = _mm_loadu_si128((const __m128i*)(buffer + 0x20));
+	x4 = _mm_loadu_si128((const __m128i*)(buffer + 0x30));
+	x1 = _mm_xor_si128(x1, _mm_cvtsi32_si128(int(crc)));
 
-	// Start out with all bits set high.
-	u32 ulCRC = 0xffffffff;
-	u8* buffer = (u8*)P;
+	x0 = _mm_load_si128((const __m128i*)k1k2);
+	buffer += 64;
+	len -= 64;
 
-	// Perform the algorithm on each character
-	// in the string, using the lookup table values.
-	while (len--)
-		ulCRC = (ulCRC >> 8) ^ crc32_table[(ulCRC & 0xFF) ^ *buffer++];
+	for (; len >= 64; len -= 64, buffer += 64)
+	{
+		x5 = _mm_clmulepi64_si128(x1, x0, 0x00);
+		x6 = _mm_clmulepi64_si128(x2, x0, 0x00);
+		x7 = _mm_clmulepi64_si128(x3, x0, 0x00);
+		x8 = _mm_clmulepi64_si128(x4, x0, 0x00);
 
-	// Exclusive OR the result with the beginning value.
-	return ulCRC ^ 0xffffffff;
+		x1 = _mm_clmulepi64_si128(x1, x0, 0x11);
+		x2 = _mm_clmulepi64_si128(x2, x0, 0x11);
+		x3 = _mm_clmulepi64_si128(x3, x0, 0x11);
+		x4 = _mm_clmulepi64_si128(x4, x0, 0x11);
+
+		x1 = _mm_xor_si128(_mm_xor_si128(x1, x5), _mm_loadu_si128((const __m128i*)(buffer + 0x00)));
+		x2 = _mm_xor_si128(_mm_xor_si128(x2, x6), _mm_loadu_si128((const __m128i*)(buffer + 0x10)));
+		x3 = _mm_xor_si128(_mm_xor_si128(x3, x7), _mm_loadu_si128((const __m128i*)(buffer + 0x20)));
+		x4 = _mm_xor_si128(_mm_xor_si128(x4, x8), _mm_loadu_si128((const __m128i*)(buffer + 0x30)));
+	}
+
+	// four lanes into one
+	x0 = _mm_load_si128((const __m128i*)k3k4);
+
+	x5 = _mm_clmulepi64_si128(x1, x0, 0x00);
+	x1 = _mm_clmulepi64_si128(x1, x0, 0x11);
+	x1 = _mm_xor_si128(_mm_xor_si128(x1, x2), x5);
+
+	x5 = _mm_clmulepi64_si128(x1, x0, 0x00);
+	x1 = _mm_clmulepi64_si128(x1, x0, 0x11);
+	x1 = _mm_xor_si128(_mm_xor_si128(x1, x3), x5);
+
+	x5 = _mm_clmulepi64_si128(x1, x0, 0x00);
+	x1 = _mm_clmulepi64_si128(x1, x0, 0x11);
+	x1 = _mm_xor_si128(_mm_xor_si128(x1, x4), x5);
+
+	// remaining 16 byte blocks
+	for (; len >= 16; len -= 16, buffer += 16)
+	{
+		x5 = _mm_clmulepi64_si128(x1, x0, 0x00);
+		x1 = _mm_clmulepi64_si128(x1, x0, 0x11);
+		x1 = _mm_xor_si128(_mm_xor_si128(x1, _mm_loadu_si128((const __m128i*)buffer)), x5);
+	}
+
+	// 128 bits to 64
+	x2 = _mm_clmulepi64_si128(x1, x0, 0x10);
+	x3 = _mm_setr_epi32(~0, 0, ~0, 0);
+	x1 = _mm_srli_si128(x1, 8);
+	x1 = _mm_xor_si128(x1, x2);
+
+	x0 = _mm_loadl_epi64((const __m128i*)k5k0);
+
+	x2 = _mm_srli_si128(x1, 4);
+	x1 = _mm_and_si128(x1, x3);
+	x1 = _mm_clmulepi64_si128(x1, x0, 0x00);
+	x1 = _mm_xor_si128(x1, x2);
+
+	// Barrett reduction to 32 bits
+	x0 = _mm_load_si128((const __m128i*)poly);
+
+	x2 = _mm_and_si128(x1, x3);
+	x2 = _mm_clmulepi64_si128(x2, x0, 0x10);
+	x2 = _mm_and_si128(x2, x3);
+	x2 = _mm_clmulepi64_si128(x2, x0, 0x00);
+	x1 = _mm_xor_si128(x1, x2);
+
+	return u32(_mm_extract_epi32(x1, 1));
 }
 
-u32 crc32(const void* P, u32 len, u32 starting_crc)
+static u32 crc32_update(u32 crc, const u8* buffer, u32 len)
 {
-	if (!crc32_ready)
+	if (crc32_clmul && len >= crc32_clmul_min)
 	{
-		crc32_init();
-		crc32_ready = TRUE;
+		u32 folded = len & ~15u;
+		crc = crc32_folded(crc, buffer, folded);
+		buffer += folded;
+		len -= folded;
 	}
 
-	u32 ulCRC = 0xffffffff ^ starting_crc;
-	u8* buffer = (u8*)P;
+	return crc32_sliced(crc, buffer, len);
+}
 
-	while (len--)
-		ulCRC = (ulCRC >> 8) ^ crc32_table[(ulCRC & 0xFF) ^ *buffer++];
+u32 crc32(const void* P, u32 len)
+{
+	crc32_check_init();
 
-	return ulCRC ^ 0xffffffff;
+	// Start out with all bits set high, exclusive OR the result with the beginning value.
+	return crc32_update(0xffffffff, (const u8*)P, len) ^ 0xffffffff;
+}
+
+u32 crc32(const void* P, u32 len, u32 starting_crc)
+{
+	crc32_check_init();
+
+	return crc32_update(0xffffffff ^ starting_crc, (const u8*)P, len) ^ 0xffffffff;
 }
 
 u32 path_crc32(const char* path, u32 len)
 {
-	if (!crc32_ready)
-	{
-		crc32_init();
-		crc32_ready = TRUE;
-	}
+	crc32_check_init();
 
 	u32 ulCRC = 0xffffffff;
 	u8* buffer = (u8*)path;
@@ -102,7 +234,7 @@ u32 path_crc32(const char* path, u32 len)
 		const u8 c = *buffer;
 		if (c != '/' && c != '\\')
 		{
-			ulCRC = (ulCRC >> 8) ^ crc32_table[(ulCRC & 0xFF) ^ *buffer];
+			ulCRC = (ulCRC >> 8) ^ crc32_table[0][(ulCRC & 0xFF) ^ *buffer];
 		}
 
 		++buffer;
@@ -110,3 +242,153 @@ u32 path_crc32(const char* path, u32 len)
 
 	return ulCRC ^ 0xffffffff;
 }
+
+// 64-bit hash for hash tables and caches: xxHash64, stripes of 32 bytes in four independent lanes.
+// Unlike crc32 it may be replaced later, files storing it have to carry a format version.
+static const u64 hash64_prime1 = 0x9E3779B185EBCA87ull;
+static const u64 hash64_prime2 = 0xC2B2AE3D27D4EB4Full;
+static const u64 hash64_prime3 = 0x165667B19E3779F9ull;
+static const u64 hash64_prime4 = 0x85EBCA77C2B2AE63ull;
+static const u64 hash64_prime5 = 0x27D4EB2F165667C5ull;
+
+IC u64 hash64_rotl(u64 value, int bits)
+{
+	return (value << bits) | (value >> (64 - bits));
+}
+
+IC u64 hash64_round(u64 acc, u64 input)
+{
+	acc += input * hash64_prime2;
+	return hash64_rotl(acc, 31) * hash64_prime1;
+}
+
+IC u64 hash64_merge(u64 acc, u64 value)
+{
+	acc ^= hash64_round(0, value);
+	return acc * hash64_prime1 + hash64_prime4;
+}
+
+u64 hash64(const void* P, u32 len, u64 seed)
+{
+	const u8* buffer = (const u8*)P;
+	const u8* end = buffer + len;
+	u64 h;
+
+	if (len >= 32)
+	{
+		u64 v1 = seed + hash64_prime1 + hash64_prime2;
+		u64 v2 = seed + hash64_prime2;
+		u64 v3 = seed;
+		u64 v4 = seed - hash64_prime1;
+
+		for (const u8* limit = end - 32; buffer <= limit; buffer += 32)
+		{
+			v1 = hash64_round(v1, *(const u64*)(buffer + 0));
+			v2 = hash64_round(v2, *(const u64*)(buffer + 8));
+			v3 = hash64_round(v3, *(const u64*)(buffer + 16));
+			v4 = hash64_round(v4, *(const u64*)(buffer + 24));
+		}
+
+		h = hash64_rotl(v1, 1) + hash64_rotl(v2, 7) + hash64_rotl(v3, 12) + hash64_rotl(v4, 18);
+		h = hash64_merge(h, v1);
+		h = hash64_merge(h, v2);
+		h = hash64_merge(h, v3);
+		h = hash64_merge(h, v4);
+	}
+	else
+		h = seed + hash64_prime5;
+
+	h += len;
+
+	for (; buffer + 8 <= end; buffer += 8)
+	{
+		h ^= hash64_round(0, *(const u64*)buffer);
+		h = hash64_rotl(h, 27) * hash64_prime1 + hash64_prime4;
+	}
+
+	if (buffer + 4 <= end)
+	{
+		h ^= u64(*(const u32*)buffer) * hash64_prime1;
+		h = hash64_rotl(h, 23) * hash64_prime2 + hash64_prime3;
+		buffer += 4;
+	}
+
+	for (; buffer < end; ++buffer)
+	{
+		h ^= (*buffer) * hash64_prime5;
+		h = hash64_rotl(h, 11) * hash64_prime1;
+	}
+
+	h ^= h >> 33;
+	h *= hash64_prime2;
+	h ^= h >> 29;
+	h *= hash64_prime3;
+	h ^= h >> 32;
+	return h;
+}
+
+// Checks every crc32 path against the bytewise reference and logs the throughput of each for
+// buffers of the given size, 0 runs a set of sizes from shared string to archive block.
+XRCORE_API void _hash_benchmark(u32 size)
+{
+	crc32_check_init();
+
+	static const u32 default_sizes[] = {16, 64, 256, 4096, 65536, 1024 * 1024};
+	const u32* sizes = size ? &size : default_sizes;
+	u32 size_count = size ? 1 : sizeof(default_sizes) / sizeof(default_sizes[0]);
+
+	Msg("* hash benchmark: pclmulqdq %s", crc32_clmul ? "available" : "not available");
+
+	for (u32 i = 0; i < size_count; ++i)
+	{
+		u32 length = sizes[i];
+		xr_vector<u8> data(length + 1);
+		u32 seed = 0x12345678;
+		for (xr_vector<u8>::iterator I = data.begin(); I != data.end(); ++I)
+		{
+			seed = seed * 1664525 + 1013904223;
+			*I = u8(seed >> 24);
+		}
+
+		// odd address, the sliced and folded paths must handle unaligned heads
+		const u8* buffer = &data.front() + 1;
+		u32 iterations = _max(u32(1), u32((64 << 20) / length));
+		u32 reference = crc32_bytewise(0xffffffff, buffer, length);
+
+		bool valid = (crc32_sliced(0xffffffff, buffer, length) == reference) &&
+			(crc32_update(0xffffffff, buffer, length) == reference);
+		if (crc32_clmul && length >= 64)
+			valid = valid && (crc32_sliced(crc32_folded(0xffffffff, buffer, length & ~15u), buffer + (length & ~15u),
+				length & 15u) == reference);
+
+		float time[4] = {0.f, 0.f, 0.f, 0.f};
+		u64 sink = 0;
+		CTimer timer;
+
+		timer.Start();
+		for (u32 j = 0; j < iterations; ++j)
+			sink += crc32_bytewise(j, buffer, length);
+		time[0] = timer.GetElapsed_sec();
+
+		timer.Start();
+		for (u32 j = 0; j < iterations; ++j)
+			sink += crc32_sliced(j, buffer, length);
+		time[1] = timer.GetElapsed_sec();
+
+		timer.Start();
+		for (u32 j = 0; j < iterations; ++j)
+			sink += crc32_update(j, buffer, length);
+		time[2] = timer.GetElapsed_sec();
+
+		timer.Start();
+		for (u32 j = 0; j < iterations; ++j)
+			sink += hash64(buffer, length, j);
+		time[3] = timer.GetElapsed_sec();
+
+		float megabytes = float(length) * float(iterations) / float(1024 * 1024);
+		Msg("%c %7d bytes: crc32 bytewise %6.0f MB/s, sliced %6.0f MB/s, dispatched %6.0f MB/s, hash64 %6.0f MB/s [%08x]",
+			valid ? '*' : '!', length,
+			megabytes / _max(time[0], EPS_S), megabytes / _max(time[1], EPS_S),
+			megabytes / _max(time[2], EPS_S), megabytes / _max(time[3], EPS_S), u32(sink));
+	}
+}
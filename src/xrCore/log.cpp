@@ -13,35 +13,309 @@
 #include <iomanip>
 #include <sstream>
 #include <string>
+#include <atomic>
 
 extern BOOL LogExecCB = TRUE;
+int psLogMaxSize = 64;
 static string_path logFName = "engine.log";
 static string_path log_file_name = "engine.log";
 static BOOL no_log = TRUE;
+static BOOL log_pending = TRUE; // lines logged before CreateLog wait in the ring
 #ifdef PROFILE_CRITICAL_SECTIONS
 static xrCriticalSection logCS(MUTEX_PROFILE_ID(log));
+static xrCriticalSection writerCS(MUTEX_PROFILE_ID(log_writer));
 #else // PROFILE_CRITICAL_SECTIONS
 static xrCriticalSection logCS;
+static xrCriticalSection writerCS;
 #endif // PROFILE_CRITICAL_SECTIONS
-xr_vector<shared_str>* LogFile = NULL;
+CLogHistory* LogFile = NULL;
 static LogCallback LogCB = 0;
 
-void FlushLog()
+static const u32 log_history_size = 8192;
+
+// Lines bound for the log file go through a ring of fixed slots. A producer reserves all slots
+// of a line with a single CAS on the tail and publishes each one by its sequence number, so it
+// never waits: when the ring is full the line is counted as dropped. The writer thread is the
+// only consumer, it appends the lines to the file and rotates it by size. FlushLog drains the
+// ring on the calling thread, which is what the crash handler relies on.
+namespace log_ring
 {
-	if (!no_log && LogFile != nullptr)
+	const u32 slot_count = 8192; // power of two
+	const u32 slot_mask = slot_count - 1;
+	const u32 slot_text = 248;
+	const u32 max_parts = 16;
+
+	struct slot
 	{
-		logCS.Enter();
-		IWriter* f = FS.w_open(logFName);
-		if (f)
+		std::atomic<u32> sequence;
+		u16 length;
+		u16 parts; // slots taken by the line, valid in its first slot
+		char text[slot_text];
+	};
+
+	static slot slots[slot_count];
+	static bool created = false;
+	static std::atomic<u32> tail;
+	static u32 head = 0; // writer side only, under writerCS
+	static std::atomic<u32> dropped;
+
+	void create()
+	{
+		for (u32 i = 0; i < slot_count; ++i)
+			slots[i].sequence.store(i);
+		tail.store(0);
+		dropped.store(0);
+		head = 0;
+		created = true;
+	}
+
+	void destroy()
+	{
+		created = false;
+	}
+
+	bool push(LPCSTR line, u32 length)
+	{
+		if (!created)
+			return false;
+
+		length = _min(length, max_parts * slot_text);
+		u32 parts = _max(u32(1), (length + slot_text - 1) / slot_text);
+
+		u32 pos = tail.load(std::memory_order_relaxed);
+		for (;;)
+		{
+			// the reader frees slots in order, so the last one being free means all of them are
+			u32 last = pos + parts - 1;
+			s32 diff = s32(slots[last & slot_mask].sequence.load(std::memory_order_acquire) - last);
+			if (!diff)
+			{
+				if (tail.compare_exchange_weak(pos, pos + parts, std::memory_order_relaxed))
+					break;
+			}
+			else if (diff < 0)
+			{
+				dropped.fetch_add(1, std::memory_order_relaxed);
+				return false;
+			}
+			else
+				pos = tail.load(std::memory_order_relaxed);
+		}
+
+		for (u32 i = 0; i < parts; ++i)
+		{
+			slot& s = slots[(pos + i) & slot_mask];
+			u32 size = _min(length - i * slot_text, slot_text);
+			CopyMemory(s.text, line + i * slot_text, size);
+			s.length = u16(size);
+			s.parts = u16(parts);
+			s.sequence.store(pos + i + 1, std::memory_order_release);
+		}
+
+		return true;
+	}
+
+	// takes the next complete line, false if there is none yet
+	bool pop(xr_string& line)
+	{
+		if (!created)
+			return false;
+
+		slot& first = slots[head & slot_mask];
+		if (first.sequence.load(std::memory_order_acquire) != head + 1)
+			return false;
+
+		u32 parts = first.parts;
+		for (u32 i = 1; i < parts; ++i)
+			if (slots[(head + i) & slot_mask].sequence.load(std::memory_order_acquire) != head + i + 1)
+				return false;
+
+		line.clear();
+		for (u32 i = 0; i < parts; ++i)
+		{
+			slot& s = slots[(head + i) & slot_mask];
+			line.append(s.text, s.length);
+			s.sequence.store(head + i + slot_count, std::memory_order_release);
+		}
+
+		head += parts;
+		return true;
+	}
+
+	u32 used()
+	{
+		return tail.load(std::memory_order_relaxed) - head;
+	}
+}
+
+namespace log_writer
+{
+	static FILE* file = NULL;
+	static u32 file_size = 0;
+	static HANDLE wake_event = NULL;
+	static HANDLE done_event = NULL;
+	static volatile BOOL quit = FALSE;
+
+	// repeated lines are written once with the count, as the console shows them
+	static xr_string last_line;
+	static u32 last_count = 0;
+	static bool last_written = true;
+	static xr_string line;
+
+	void open(LPCSTR mode)
+	{
+		file = fopen(logFName, mode);
+		file_size = 0;
+		if (file)
+		{
+			fseek(file, 0, SEEK_END);
+			file_size = (u32)ftell(file);
+		}
+	}
+
+	void rotate()
+	{
+		fclose(file);
+
+		string_path rotated;
+		xr_sprintf(rotated, "%s.1", logFName);
+		MoveFileEx(logFName, rotated, MOVEFILE_REPLACE_EXISTING);
+
+		open("wb");
+	}
+
+	void write(LPCSTR text, u32 length, u32 count)
+	{
+		if (!file)
+			return;
+
+		fwrite(text, 1, length, file);
+		file_size += length + 2;
+		if (count > 1)
+		{
+			string32 suffix;
+			int size = xr_sprintf(suffix, " [%d]", count);
+			fwrite(suffix, 1, size, file);
+			file_size += size;
+		}
+		fwrite("\r\n", 1, 2, file);
+
+		if (psLogMaxSize > 0 && u64(file_size) >= u64(psLogMaxSize) << 20)
+			rotate();
+	}
+
+	void write_last()
+	{
+		if (last_written)
+			return;
+
+		write(last_line.c_str(), last_line.size(), last_count);
+		last_written = true;
+	}
+
+	// writerCS must be held
+	void drain()
+	{
+		while (log_ring::pop(line))
 		{
-			for (u32 it = 0; it < LogFile->size(); it++)
+			if (last_count && line == last_line)
 			{
-				LPCSTR s = *((*LogFile)[it]);
-				f->w_string(s ? s : "");
+				++last_count;
+				last_written = false;
+				continue;
 			}
-			FS.w_close(f);
+
+			write_last();
+			last_line.swap(line);
+			last_count = 1;
+			last_written = false;
+		}
+
+		write_last();
+
+		u32 dropped = log_ring::dropped.exchange(0);
+		if (dropped)
+		{
+			string64 notice;
+			int size = xr_sprintf(notice, "! log: %d line(s) dropped, the log ring was full", dropped);
+			write(notice, size, 1);
+		}
+
+		if (file)
+			fflush(file);
+	}
+
+	void __cdecl writer_thread(void*)
+	{
+		while (!quit)
+		{
+			WaitForSingleObject(wake_event, 50);
+
+			writerCS.Enter();
+			drain();
+			writerCS.Leave();
+		}
+
+		SetEvent(done_event);
+	}
+
+	void start()
+	{
+		open("ab");
+		wake_event = CreateEvent(NULL, FALSE, FALSE, NULL);
+		done_event = CreateEvent(NULL, TRUE, FALSE, NULL);
+		quit = FALSE;
+		thread_spawn(writer_thread, "X-RAY Log Writer", 0, NULL);
+	}
+
+	void stop()
+	{
+		if (!wake_event)
+			return;
+
+		quit = TRUE;
+		SetEvent(wake_event);
+		WaitForSingleObject(done_event, 5000);
+		CloseHandle(wake_event);
+		CloseHandle(done_event);
+		wake_event = NULL;
+		done_event = NULL;
+	}
+
+	void wake()
+	{
+		// the writer polls anyway, only wake it early when the ring fills up
+		if (wake_event && log_ring::used() > log_ring::slot_count / 2)
+			SetEvent(wake_event);
+	}
+}
+
+void FlushLog()
+{
+	if (!no_log && LogFile != nullptr)
+	{
+		writerCS.Enter();
+		log_writer::drain();
+		writerCS.Leave();
+	}
+}
+
+void ClearLog()
+{
+	logCS.Enter();
+	LogFile->clear_not_free();
+	logCS.Leave();
+
+	if (!no_log)
+	{
+		writerCS.Enter();
+		log_writer::drain();
+		if (log_writer::file)
+		{
+			fclose(log_writer::file);
+			log_writer::open("wb");
 		}
-		logCS.Leave();
+		writerCS.Leave();
 	}
 }
 
@@ -88,51 +362,55 @@ void AddOne(const char* split)
 	if (!LogFile)
 		return;
 
-	logCS.Enter();
-
 #ifdef DEBUG
     OutputDebugString(split);
     OutputDebugString("\n");
 #endif
 
+	// demonized: add timestamps to log
+	std::string t = split;
+	if (logTimestamps) {
+		std::string c = "";
+		if (t.length() > 0 && is_console_mark((Console_mark)t[0])) {
+			c = t[0];
+			c += " ";
+			t.erase(0, 1);
+		}
+		t = c + "[" + timeInHMSMMM() + "] " + t;
+	}
+
+	// file: lock free, before CreateLog the ring just keeps the lines
+	if (!no_log || log_pending)
+	{
+		log_ring::push(t.c_str(), t.length());
+		log_writer::wake();
+	}
+
+	logCS.Enter();
+
 	// DUMP_PHASE;
 	{
-		// demonized: add timestamps to log
-		std::string t = split;
-		if (logTimestamps) {
-			std::string c = "";
-			if (t.length() > 0 && is_console_mark((Console_mark)t[0])) {
-				c = t[0];
-				c += " ";
-				t.erase(0, 1);
-			}
-			t = c + "[" + timeInHMSMMM() + "] " + t;
-		}
-		auto temp = shared_str(t.c_str());
-		static shared_str last_str;
+		static xr_string last_str;
 		static int items_count;
 
-		if (last_str.equal(temp))
+		if (LogFile->size() && !xr_strcmp(last_str.c_str(), t.c_str()))
 		{
-			xr_string tmp = temp.c_str();
-
 			if (items_count == 0)
 				items_count = 2;
 			else
 				items_count++;
 
+			xr_string& tmp = LogFile->back();
+			tmp = last_str;
 			tmp += " [";
 			tmp += std::to_string(items_count).c_str();
 			tmp += "]";
-
-			LogFile->erase(LogFile->end()-1);
-			LogFile->push_back(shared_str(tmp.c_str()));
 		}
 		else
 		{
 			// DUMP_PHASE;
-			LogFile->push_back(temp);
-			last_str = temp;
+			LogFile->push_back(t.c_str());
+			last_str = t.c_str();
 			items_count = 0;
 		}
 	}
@@ -273,13 +551,14 @@ LPCSTR log_name()
 void InitLog()
 {
 	R_ASSERT(LogFile == NULL);
-	LogFile = xr_new<xr_vector<shared_str>>();
-	LogFile->reserve(1000);
+	LogFile = xr_new<CLogHistory>(log_history_size);
+	log_ring::create();
 }
 
 void CreateLog(BOOL nl)
 {
 	no_log = nl;
+	log_pending = FALSE;
 	strconcat(sizeof(log_file_name), log_file_name, Core.ApplicationName, "_", Core.UserName, ".log");
 	if (FS.path_exist("$logs$"))
 		FS.update_path(logFName, "$logs$", log_file_name);
@@ -296,13 +575,22 @@ void CreateLog(BOOL nl)
 			abort();
 		}
 		FS.w_close(f);
+
+		log_writer::start();
 	}
 }
 
 void CloseLog(void)
 {
+	log_writer::stop();
 	FlushLog();
-	LogFile->clear();
+	if (log_writer::file)
+	{
+		fclose(log_writer::file);
+		log_writer::file = NULL;
+	}
+	log_ring::destroy();
+	LogFile->clear_not_free();
 	xr_delete(LogFile);
 }
 
@@ -20,9 +20,41 @@ void XRCORE_API CreateLog(BOOL no_log = FALSE);
 void InitLog();
 void CloseLog();
 void XRCORE_API FlushLog();
+void XRCORE_API ClearLog();
 
-extern XRCORE_API xr_vector<shared_str>* LogFile;
+// Last lines of the log, shown by the console. Older lines are dropped once it is full,
+// the log file keeps everything.
+class XRCORE_API CLogHistory
+{
+	xr_vector<xr_string> m_lines;
+	u32 m_first;
+	u32 m_count;
+
+public:
+	CLogHistory(u32 capacity) : m_first(0), m_count(0) { m_lines.resize(capacity); }
+	u32 size() const { return m_count; }
+	const xr_string& operator[](u32 i) const { return m_lines[(m_first + i) % m_lines.size()]; }
+	xr_string& back() { return m_lines[(m_first + m_count - 1) % m_lines.size()]; }
+
+	void push_back(LPCSTR line)
+	{
+		if (m_count < m_lines.size())
+			++m_count;
+		else
+			m_first = (m_first + 1) % m_lines.size();
+		back() = line;
+	}
+
+	void clear_not_free()
+	{
+		m_first = 0;
+		m_count = 0;
+	}
+};
+
+extern XRCORE_API CLogHistory* LogFile;
 extern XRCORE_API BOOL LogExecCB;
+extern XRCORE_API int psLogMaxSize; // Mb, the log file is rotated when it grows past it, 0 - never
 
 shared_str FormatString(LPCSTR fmt, ...);
 
@@ -301,6 +301,7 @@ DEFINE_VECTOR(xr_rtoken, RTokenVec, RTokenVecIt);
 #endif
 #include "FileSystem.h"
 #include "FTimer.h"
+#include "xr_trace.h"
 #include "fastdelegate.h"
 #include "intrusive_ptr.h"
 
@@ -65,9 +65,42 @@ private:
 	string_path m_file_name;
 	Root DATA;
 
-	// demonized: cache read and written ini values
-	xr_unordered_map<std::string, xr_unordered_map<std::string, shared_str>> m_cache;
-	void cacheValue(LPCSTR S, LPCSTR L, shared_str& V);
+	// Hashed lookup over read-only files. Hits are verified by name; hash collisions fall back to
+	// the sorted search. The index points into the sections, so every write drops it for good.
+	typedef xr_unordered_map<u64, Sect*> SectionIndex;
+	typedef xr_unordered_map<u64, const Item*> LineIndex;
+	SectionIndex m_section_index;
+	LineIndex m_line_index;
+	u32 m_indexed_sections;
+
+	IC static u64 name_hash(LPCSTR name, u64 seed = 0)
+	{
+		return hash64(name, xr_strlen(name), seed);
+	}
+
+	IC static u64 line_hash(u64 section_hash, LPCSTR line)
+	{
+		return name_hash(line, section_hash);
+	}
+
+	void index_section(Sect* section, u64 hash);
+	void index_line(const Item* item, u64 hash);
+	void build_index();
+	bool index_valid() const { return m_indexed_sections && m_indexed_sections == DATA.size() && m_flags.test(eReadOnly); }
+	Sect* find_section(LPCSTR S) const;
+	const Item* find_line(LPCSTR S, LPCSTR L) const;
+
+	// Compiled snapshot of a file and everything it pulled in (includes, DLTX mods), stored in
+	// $app_data_root$ and used while none of the sources changed
+	struct Dependencies;
+	Dependencies* m_dependencies;
+
+	void snapshot_name(string_path& result) const;
+	bool load_snapshot();
+	void begin_snapshot();
+	void end_snapshot();
+	void track_file(LPCSTR file_name);
+	void track_list(LPCSTR path, LPCSTR mask);
 
 	void Load(IReader* F, LPCSTR path
 #ifndef _EDITOR
@@ -0,0 +1,62 @@
+#ifndef xr_parallelH
+#define xr_parallelH
+#pragma once
+
+// Minimal data-parallel helpers on top of the Concurrency Runtime (PPL) shipped with MSVC.
+// Work items must not touch shared state without their own synchronization; results that
+// feed back into the game are expected to be written per item and merged on the calling
+// thread in item order, which keeps the outcome independent of scheduling.
+
+#include <ppl.h>
+#include <thread>
+
+// Calls fn(i) for every i in [begin, end). Ranges shorter than 'grain' run inline.
+template <typename Fn>
+IC void xr_parallel_for(u32 begin, u32 end, u32 grain, const Fn& fn)
+{
+	if (begin >= end)
+		return;
+
+	if (grain < 1)
+		grain = 1;
+
+	u32 count = end - begin;
+	if (count <= grain)
+	{
+		for (u32 i = begin; i < end; ++i)
+			fn(i);
+		return;
+	}
+
+	u32 chunks = (count + grain - 1) / grain;
+	concurrency::parallel_for(u32(0), chunks, [&](u32 chunk)
+	{
+		TRACE_ZONE("parallel_for");
+		u32 first = begin + chunk * grain;
+		u32 last = _min(first + grain, end);
+		for (u32 i = first; i < last; ++i)
+			fn(i);
+	});
+}
+
+template <typename Fn>
+IC void xr_parallel_for(u32 begin, u32 end, const Fn& fn)
+{
+	xr_parallel_for(begin, end, 1, fn);
+}
+
+template <typename Fn1, typename Fn2>
+IC void xr_parallel_invoke(const Fn1& fn1, const Fn2& fn2)
+{
+	concurrency::parallel_invoke(fn1, fn2);
+}
+
+typedef concurrency::task_group xr_task_group;
+
+IC u32 xr_parallel_workers()
+{
+	u32 count = std::thread::hardware_concurrency();
+	return count ? count : 1;
+}
+
+#endif // xr_parallelH
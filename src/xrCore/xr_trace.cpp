@@ -0,0 +1,175 @@
+#include "stdafx.h"
+#pragma hdrstop
+
+#include "xr_trace.h"
+
+// Rings are created by their thread on its first zone after tracing was started and live until
+// the process exits, threads of the task pool come and go and their zones are still wanted in the
+// dump. Only the owning thread writes to a ring; the dump reads it after tracing is switched off,
+// a zone that was still open at that moment may be lost or torn, nothing worse.
+
+namespace xr_trace
+{
+	volatile BOOL enabled = FALSE;
+
+	static const u32 ring_size = 16 * 1024;
+	static const u32 max_rings = 256;
+
+	struct event
+	{
+		LPCSTR name;
+		u64 begin;
+		u64 end;
+		string32 detail;
+	};
+
+	struct ring
+	{
+		u32 thread_id;
+		string64 thread_name;
+		u32 head;
+		event events[ring_size];
+	};
+
+	static ring* rings[max_rings];
+	static volatile LONG ring_count = 0;
+	static u64 origin = 0;
+
+	static __declspec(thread) ring* thread_ring = NULL;
+	static __declspec(thread) char thread_name[sizeof(string64)] = {0};
+
+	static ring* create_ring()
+	{
+		LONG index = InterlockedIncrement(&ring_count) - 1;
+		if (index >= LONG(max_rings))
+		{
+			InterlockedDecrement(&ring_count);
+			return NULL;
+		}
+
+		// past the engine allocator on purpose, rings outlive everything that is traced
+		ring* result = (ring*)malloc(sizeof(ring));
+		result->thread_id = GetCurrentThreadId();
+		xr_strcpy(result->thread_name, thread_name);
+		result->head = 0;
+
+		rings[index] = result;
+		return result;
+	}
+
+	void record(LPCSTR name, const char* detail, u64 begin, u64 end)
+	{
+		if (!thread_ring)
+		{
+			thread_ring = create_ring();
+			if (!thread_ring)
+				return;
+		}
+
+		ring& R = *thread_ring;
+		event& E = R.events[R.head % ring_size];
+		E.name = name;
+		E.begin = begin;
+		E.end = end;
+		if (detail)
+			xr_strcpy(E.detail, detail);
+		else
+			E.detail[0] = 0;
+		++R.head;
+	}
+
+	void set_thread_name(LPCSTR name)
+	{
+		xr_strcpy(thread_name, name);
+		if (thread_ring)
+			xr_strcpy(thread_ring->thread_name, name);
+	}
+
+	void start()
+	{
+		enabled = FALSE;
+		for (LONG i = 0, n = ring_count; i < n; ++i)
+			if (rings[i])
+				rings[i]->head = 0;
+
+		origin = now();
+		enabled = TRUE;
+	}
+
+	void stop()
+	{
+		enabled = FALSE;
+	}
+
+	static void write_escaped(string512& result, LPCSTR text)
+	{
+		u32 length = 0;
+		for (; *text && length + 2 < sizeof(result); ++text)
+		{
+			char c = *text;
+			if (c == '"' || c == '\\')
+				result[length++] = '\\';
+			result[length++] = (u8(c) < ' ') ? ' ' : c;
+		}
+		result[length] = 0;
+	}
+
+	bool dump(LPCSTR file_name)
+	{
+		BOOL was_enabled = enabled;
+		enabled = FALSE;
+
+		IWriter* W = FS.w_open(file_name);
+		if (!W)
+		{
+			enabled = was_enabled;
+			return false;
+		}
+
+		double to_us = 1000000.0 / double(CPU::qpc_freq);
+		u32 pid = GetCurrentProcessId();
+		u32 count = 0;
+
+		W->w_string("{\"displayTimeUnit\": \"ms\", \"traceEvents\": [");
+		for (LONG i = 0, n = ring_count; i < n; ++i)
+		{
+			ring* R = rings[i];
+			if (!R)
+				continue;
+
+			string512 name, detail;
+			string1024 line;
+			write_escaped(name, R->thread_name[0] ? R->thread_name : "worker");
+			xr_sprintf(line, "%s{\"name\": \"thread_name\", \"ph\": \"M\", \"pid\": %d, \"tid\": %d, \"args\": {\"name\": \"%s\"}}",
+			           count++ ? "," : "", pid, R->thread_id, name);
+			W->w_string(line);
+
+			u32 head = R->head;
+			for (u32 it = head > ring_size ? head - ring_size : 0; it < head; ++it)
+			{
+				const event& E = R->events[it % ring_size];
+				if (E.begin < origin)
+					continue;
+
+				write_escaped(name, E.name);
+				xr_sprintf(line, ",{\"name\": \"%s\", \"ph\": \"X\", \"pid\": %d, \"tid\": %d, \"ts\": %.3f, \"dur\": %.3f",
+				           name, pid, R->thread_id, double(E.begin - origin) * to_us, double(E.end - E.begin) * to_us);
+
+				if (E.detail[0])
+				{
+					write_escaped(detail, E.detail);
+					xr_strcat(line, ", \"args\": {\"detail\": \"");
+					xr_strcat(line, detail);
+					xr_strcat(line, "\"}");
+				}
+				xr_strcat(line, "}");
+				W->w_string(line);
+			}
+		}
+		W->w_string("]}");
+		FS.w_close(W);
+
+		enabled = was_enabled;
+		return true;
+	}
+}
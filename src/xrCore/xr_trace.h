@@ -0,0 +1,68 @@
+#ifndef xr_traceH
+#define xr_traceH
+#pragma once
+
+// Scoped-zone frame tracer, compiled into every build.
+// Each thread records finished zones into its own ring buffer, so recording takes no lock; the
+// oldest zones are overwritten once a ring is full. While tracing is off a zone costs one load
+// and a branch. xr_trace_dump writes everything still held by the rings as Chrome trace JSON,
+// which chrome://tracing and Perfetto open directly.
+// Zone names must be string literals or otherwise outlive the dump; details (object names and
+// the like) are copied.
+
+namespace xr_trace
+{
+	XRCORE_API extern volatile BOOL enabled;
+
+	XRCORE_API void record(LPCSTR name, const char* detail, u64 begin, u64 end);
+	XRCORE_API void set_thread_name(LPCSTR name);
+
+	XRCORE_API void start();
+	XRCORE_API void stop();
+	XRCORE_API bool dump(LPCSTR file_name);
+
+	IC u64 now()
+	{
+		LARGE_INTEGER result;
+		QueryPerformanceCounter(&result);
+		return u64(result.QuadPart);
+	}
+
+	class zone
+	{
+		LPCSTR m_name;
+		u64 m_begin;
+		string32 m_detail;
+
+		zone(const zone&);
+		void operator=(const zone&);
+
+	public:
+		IC zone(LPCSTR name, LPCSTR detail = NULL) :
+			m_name(enabled ? name : NULL)
+		{
+			if (!m_name)
+				return;
+			// copied up front, the owner of the detail may be gone by the time the zone closes
+			if (detail)
+				strncpy_s(m_detail, detail, _TRUNCATE);
+			else
+				m_detail[0] = 0;
+			m_begin = now();
+		}
+
+		IC ~zone()
+		{
+			if (m_name)
+				record(m_name, m_detail, m_begin, now());
+		}
+	};
+}
+
+#define XR_TRACE_CONCAT_(a, b) a##b
+#define XR_TRACE_CONCAT(a, b) XR_TRACE_CONCAT_(a, b)
+
+#define TRACE_ZONE(name) xr_trace::zone XR_TRACE_CONCAT(_trace_zone_, __LINE__)(name)
+#define TRACE_ZONE_DETAIL(name, detail) xr_trace::zone XR_TRACE_CONCAT(_trace_zone_, __LINE__)(name, xr_trace::enabled ? (detail) : NULL)
+
+#endif // xr_traceH
@@ -34,6 +34,7 @@
 // Construction/Destruction
 //////////////////////////////////////////////////////////////////////
 ENGINE_API float psVisDistance = 1.f;
+ENGINE_API int psWeatherCycles = 4;
 static const float MAX_NOISE_FREQ = 0.03f;
 
 //#define WEATHER_LOGGING
@@ -324,6 +325,9 @@ void CEnvironment::SetWeather(shared_str name, bool forced)
 			CurrentWeather = &it->second;
 			CurrentWeatherName = it->first;
 		}
+		// a deferred cycle that is not loaded yet gets its descriptors at the next time key
+		if (!it->second.empty())
+			weather_cycle(it->first);
 		if (forced) { SelectEnvs(fGameTime); }
 #ifdef WEATHER_LOGGING
         Msg("Starting Cycle: %s [%s]", *name, forced ? "forced" : "deferred");
@@ -346,7 +350,9 @@ bool CEnvironment::SetWeatherFX(shared_str name)
 		R_ASSERT3(it != WeatherFXs.end(), "Invalid weather effect name.", *name);
 		EnvVec* PrevWeather = CurrentWeather;
 		VERIFY(PrevWeather);
-		CurrentWeather = &it->second;
+		if (PrevWeather->empty())
+			weather_cycle(CurrentWeatherName);
+		CurrentWeather = &weather_effect(it->first);
 		CurrentWeatherName = it->first;
 
 		float rewind_tm = WFX_TRANS_TIME * fTimeFactor;
@@ -423,9 +429,10 @@ void CEnvironment::StopWFX()
 {
 	VERIFY(CurrentCycleName.size());
 	bWFX = false;
-	SetWeather(CurrentCycleName, false);
+	// taken over first, the cycle switch below may release cycles nothing points into
 	Current[0] = WFX_end_desc[0];
 	Current[1] = WFX_end_desc[1];
+	SetWeather(CurrentCycleName, false);
 #ifdef WEATHER_LOGGING
     Msg("WFX - end. Weather: '%s' Desc: '%s'/'%s' GameTime: %3.2f", CurrentWeatherName.c_str(), Current[0]->m_identifier.c_str(), Current[1]->m_identifier.c_str(), fGameTime);
 #endif
@@ -468,6 +475,9 @@ void CEnvironment::SelectEnvs(EnvVec* envs, CEnvDescriptor*& e0, CEnvDescriptor*
 void CEnvironment::SelectEnvs(float gt)
 {
 	VERIFY(CurrentWeather);
+	if (CurrentWeather->empty())
+		weather_cycle(CurrentWeatherName);
+
 	if ((Current[0] == Current[1]) && (Current[0] == 0))
 	{
 		VERIFY(!bWFX);
@@ -321,8 +321,10 @@ public:
 	shared_str CurrentWeatherName;
 	shared_str CurrentCycleName;
 
+	// cycles and effects are listed at load, their descriptors are created on first use
 	EnvsMap WeatherCycles;
 	EnvsMap WeatherFXs;
+	xr_vector<shared_str> UsedCycles; // loaded cycles, least recently selected first
 	xr_vector<CEnvModifier> Modifiers;
 	EnvAmbVec Ambients;
 
@@ -416,6 +418,10 @@ protected:
 	void load_sun();
 	INGAME_EDITOR_VIRTUAL void load_weathers();
 	INGAME_EDITOR_VIRTUAL void load_weather_effects();
+	EnvVec& weather_cycle(shared_str const& name);
+	EnvVec& weather_effect(shared_str const& name);
+	void evict_weather_cycles();
+	bool weather_cycle_in_use(EnvVec const& env) const;
 	INGAME_EDITOR_VIRTUAL void create_mixer();
 	void destroy_mixer();
 
@@ -445,4 +451,5 @@ public:
 
 ENGINE_API extern Flags32 psEnvFlags;
 ENGINE_API extern float psVisDistance;
+ENGINE_API extern int psWeatherCycles;
 #endif //EnvironmentH
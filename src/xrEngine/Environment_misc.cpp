@@ -696,6 +696,16 @@ void CEnvironment::load_sun()
 	while (i < 24);
 }
 
+// Only the names of weather cycles and effects are read at load, a cycle gets its descriptors when
+// it is first selected. Once more than psWeatherCycles cycles are loaded, the least recently selected
+// ones nothing points into are released.
+
+static void weather_file_name(string_path& result, LPCSTR path, shared_str const& id)
+{
+	FS.update_path(result, path, id.c_str());
+	xr_strcat(result, ".ltx");
+}
+
 void CEnvironment::load_weathers()
 {
 	if (!WeatherCycles.empty())
@@ -719,39 +729,11 @@ void CEnvironment::load_weathers()
 			continue;
 
 		id.assign(*i, length - 4);
-		EnvVec& env = WeatherCycles[id.c_str()];
-
-		string_path file_name;
-		FS.update_path(file_name, "$game_weathers$", id.c_str());
-		xr_strcat(file_name, ".ltx");
-		CInifile* config = CInifile::Create(file_name);
-
-		typedef CInifile::Root sections_type;
-		sections_type& sections = config->sections();
-
-		env.reserve(sections.size());
-
-		sections_type::const_iterator i = sections.begin();
-		sections_type::const_iterator e = sections.end();
-		for (; i != e; ++i)
-		{
-			CEnvDescriptor* object = create_descriptor((*i)->Name, config);
-			env.push_back(object);
-		}
-
-		CInifile::Destroy(config);
+		WeatherCycles[id.c_str()];
 	}
 
 	FS.file_list_close(file_list);
 
-	// sorting weather envs
-	EnvsMapIt _I = WeatherCycles.begin();
-	EnvsMapIt _E = WeatherCycles.end();
-	for (; _I != _E; _I++)
-	{
-		R_ASSERT3(_I->second.size() > 1, "Environment in weather must >=2", *_I->first);
-		std::sort(_I->second.begin(), _I->second.end(), sort_env_etl_pred);
-	}
 	R_ASSERT2(!WeatherCycles.empty(), "Empty weathers.");
 	SetWeather((*WeatherCycles.begin()).first.c_str());
 }
@@ -776,31 +758,7 @@ void CEnvironment::load_weather_effects()
 		VERIFY((*i)[length - 2] == 't');
 		VERIFY((*i)[length - 1] == 'x');
 		id.assign(*i, length - 4);
-		EnvVec& env = WeatherFXs[id.c_str()];
-
-		string_path file_name;
-		FS.update_path(file_name, "$game_weather_effects$", id.c_str());
-		xr_strcat(file_name, ".ltx");
-		CInifile* config = CInifile::Create(file_name);
-
-		typedef CInifile::Root sections_type;
-		sections_type& sections = config->sections();
-
-		env.reserve(sections.size() + 2);
-		env.push_back(create_descriptor("00:00:00", false));
-
-		sections_type::const_iterator i = sections.begin();
-		sections_type::const_iterator e = sections.end();
-		for (; i != e; ++i)
-		{
-			CEnvDescriptor* object = create_descriptor((*i)->Name, config);
-			env.push_back(object);
-		}
-
-		CInifile::Destroy(config);
-
-		env.push_back(create_descriptor("24:00:00", false));
-		env.back()->exec_time_loaded = DAY_LENGTH;
+		WeatherFXs[id.c_str()];
 	}
 
 	FS.file_list_close(file_list);
@@ -828,14 +786,111 @@ void CEnvironment::load_weather_effects()
         }
     }
 #endif // #if 0
+}
 
-	// sorting weather envs
-	EnvsMapIt _I = WeatherFXs.begin();
-	EnvsMapIt _E = WeatherFXs.end();
-	for (; _I != _E; _I++)
+CEnvironment::EnvVec& CEnvironment::weather_cycle(shared_str const& name)
+{
+	EnvsMapIt it = WeatherCycles.find(name);
+	R_ASSERT3(it != WeatherCycles.end(), "Invalid weather name.", *name);
+	EnvVec& env = it->second;
+
+	xr_vector<shared_str>::iterator used = std::find(UsedCycles.begin(), UsedCycles.end(), it->first);
+	if (used != UsedCycles.end())
+		UsedCycles.erase(used);
+	UsedCycles.push_back(it->first);
+
+	if (env.empty())
 	{
-		R_ASSERT3(_I->second.size() > 1, "Environment in weather must >=2", *_I->first);
-		std::sort(_I->second.begin(), _I->second.end(), sort_env_etl_pred);
+		string_path file_name;
+		weather_file_name(file_name, "$game_weathers$", it->first);
+		CInifile* config = CInifile::Create(file_name);
+
+		typedef CInifile::Root sections_type;
+		sections_type& sections = config->sections();
+
+		env.reserve(sections.size());
+
+		sections_type::const_iterator i = sections.begin();
+		sections_type::const_iterator e = sections.end();
+		for (; i != e; ++i)
+		{
+			CEnvDescriptor* object = create_descriptor((*i)->Name, config);
+			env.push_back(object);
+		}
+
+		CInifile::Destroy(config);
+
+		R_ASSERT3(env.size() > 1, "Environment in weather must >=2", *it->first);
+		std::sort(env.begin(), env.end(), sort_env_etl_pred);
+	}
+
+	evict_weather_cycles();
+	return env;
+}
+
+CEnvironment::EnvVec& CEnvironment::weather_effect(shared_str const& name)
+{
+	EnvsMapIt it = WeatherFXs.find(name);
+	R_ASSERT3(it != WeatherFXs.end(), "Invalid weather effect name.", *name);
+	EnvVec& env = it->second;
+	if (!env.empty())
+		return env;
+
+	string_path file_name;
+	weather_file_name(file_name, "$game_weather_effects$", it->first);
+	CInifile* config = CInifile::Create(file_name);
+
+	typedef CInifile::Root sections_type;
+	sections_type& sections = config->sections();
+
+	env.reserve(sections.size() + 2);
+	env.push_back(create_descriptor("00:00:00", false));
+
+	sections_type::const_iterator i = sections.begin();
+	sections_type::const_iterator e = sections.end();
+	for (; i != e; ++i)
+	{
+		CEnvDescriptor* object = create_descriptor((*i)->Name, config);
+		env.push_back(object);
+	}
+
+	CInifile::Destroy(config);
+
+	env.push_back(create_descriptor("24:00:00", false));
+	env.back()->exec_time_loaded = DAY_LENGTH;
+
+	std::sort(env.begin(), env.end(), sort_env_etl_pred);
+	return env;
+}
+
+bool CEnvironment::weather_cycle_in_use(EnvVec const& env) const
+{
+	for (EnvVec::const_iterator it = env.begin(); it != env.end(); ++it)
+	{
+		if ((*it == Current[0]) || (*it == Current[1]))
+			return true;
+		if (bWFX && ((*it == WFX_end_desc[0]) || (*it == WFX_end_desc[1])))
+			return true;
+	}
+	return false;
+}
+
+void CEnvironment::evict_weather_cycles()
+{
+	xr_vector<shared_str>::iterator it = UsedCycles.begin();
+	while ((UsedCycles.size() > u32(psWeatherCycles)) && (it != UsedCycles.end()))
+	{
+		EnvVec& env = WeatherCycles[*it];
+		if ((&env == CurrentWeather) || (*it == CurrentCycleName) || weather_cycle_in_use(env))
+		{
+			++it;
+			continue;
+		}
+
+		for (EnvIt d = env.begin(); d != env.end(); d++)
+			xr_delete(*d);
+		env.clear();
+		it = UsedCycles.erase(it);
 	}
 }
 
@@ -868,6 +923,7 @@ void CEnvironment::unload()
 	}
 
 	WeatherCycles.clear();
+	UsedCycles.clear();
 	// clear weather effect
 	_I = WeatherFXs.begin();
 	_E = WeatherFXs.end();
@@ -907,6 +963,8 @@ void CEnvironment::Reload()
 	}
 
 	WeatherCycles.clear();
+	UsedCycles.clear();
+	Invalidate();
 	load_weathers();
 	Log("Info : Weather Environment has been reloaded");
 }
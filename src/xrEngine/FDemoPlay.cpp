@@ -12,6 +12,30 @@
 
 #include "xrSash.h"
 
+// Per-subsystem times written next to the benchmark results. Timers accumulated across frames
+// are sampled as differences, per_frame ones are restarted by their owner every frame.
+struct SDemoStat
+{
+	LPCSTR name;
+	CStatTimer CStats::* timer;
+	bool per_frame;
+};
+
+static const SDemoStat demo_stats[] =
+{
+	{"engine", &CStats::EngineTOTAL, false},
+	{"scheduler", &CStats::Sheduler, false},
+	{"update_cl", &CStats::UpdateClient, false},
+	{"physics", &CStats::Physics, false},
+	{"ai_think", &CStats::AI_Think, false},
+	{"ai_path", &CStats::AI_Path, false},
+	{"ai_vision", &CStats::AI_Vis, false},
+	{"sound", &CStats::Sound, false},
+	{"render", &CStats::RenderTOTAL_Real, true},
+};
+
+static const u32 demo_stat_count = sizeof(demo_stats) / sizeof(demo_stats[0]);
+
 //////////////////////////////////////////////////////////////////////
 // Construction/Destruction
 //////////////////////////////////////////////////////////////////////
@@ -27,6 +51,11 @@ CDemoPlay::CDemoPlay(const char* name, float ms, u32 cycles, float life_time) :
 	fSpeed = ms;
 	dwCyclesLeft = cycles ? cycles : 1;
 
+	// fixed 33 ms steps make the simulation independent of how fast frames are produced
+	stat_fixed_step = g_bBenchmark && strstr(Core.Params, "-benchmark_fixed_step") && !psDeviceFlags.test(rsConstantFPS);
+	if (stat_fixed_step)
+		psDeviceFlags.set(rsConstantFPS, TRUE);
+
 	m_pMotion = 0;
 	m_MParam = 0;
 	string_path nm, fn;
@@ -72,6 +101,8 @@ CDemoPlay::CDemoPlay(const char* name, float ms, u32 cycles, float life_time) :
 CDemoPlay::~CDemoPlay()
 {
 	stat_Stop();
+	if (stat_fixed_step)
+		psDeviceFlags.set(rsConstantFPS, FALSE);
 	xr_delete(m_pMotion);
 	xr_delete(m_MParam);
 	Console->Execute("hud_weapon 1");
@@ -91,6 +122,114 @@ void CDemoPlay::stat_Start()
 	stat_table.clear();
 	stat_table.reserve(1024);
 	fStartTime = 0;
+
+	if (g_bBenchmark)
+	{
+		// every run replays the same random sequence
+		int seed = 1;
+		if (LPCSTR param = strstr(Core.Params, "-benchmark_seed "))
+			sscanf(param + xr_strlen("-benchmark_seed "), "%d", &seed);
+		::Random.seed(seed);
+
+		stat_subsystems.clear();
+		stat_subsystems.reserve(1024 * demo_stat_count);
+		stat_accum.resize(demo_stat_count);
+		for (u32 i = 0; i < demo_stat_count; ++i)
+			stat_accum[i] = (Device.Statistic->*demo_stats[i].timer).accum;
+	}
+}
+
+void CDemoPlay::stat_Sample()
+{
+	for (u32 i = 0; i < demo_stat_count; ++i)
+	{
+		const CStatTimer& timer = Device.Statistic->*demo_stats[i].timer;
+
+		// CStats::Show restarts the timers when the stats are on screen
+		u64 ticks = timer.accum;
+		if (!demo_stats[i].per_frame)
+		{
+			ticks = (timer.accum >= stat_accum[i]) ? timer.accum - stat_accum[i] : timer.accum;
+			stat_accum[i] = timer.accum;
+		}
+
+		stat_subsystems.push_back(float(1000.0 * double(ticks) / double(CPU::qpc_freq)));
+	}
+}
+
+static float percentile(xr_vector<float>& sorted, float q)
+{
+	if (sorted.empty())
+		return 0.f;
+	return sorted[iFloor(q * float(sorted.size() - 1) + 0.5f)];
+}
+
+void CDemoPlay::stat_Export(LPCSTR name)
+{
+	// the first entry measures the time before the first frame, the FPS statistics skip it too
+	u32 const frames = stat_table.size();
+	if (frames < 2)
+		return;
+
+	string_path fname;
+	xr_sprintf(fname, sizeof(fname), "%s.csv", name);
+	FS.update_path(fname, "$app_data_root$", fname);
+	if (IWriter* W = FS.w_open(fname))
+	{
+		string1024 line;
+		xr_strcpy(line, "frame,frame_ms");
+		for (u32 i = 0; i < demo_stat_count; ++i)
+		{
+			xr_strcat(line, ",");
+			xr_strcat(line, demo_stats[i].name);
+		}
+		W->w_string(line);
+
+		for (u32 it = 1; it < frames; ++it)
+		{
+			xr_sprintf(line, "%d,%.3f", it, 1000.f * stat_table[it]);
+			for (u32 i = 0; i < demo_stat_count; ++i)
+			{
+				string32 value;
+				xr_sprintf(value, ",%.3f", stat_subsystems[it * demo_stat_count + i]);
+				xr_strcat(line, value);
+			}
+			W->w_string(line);
+		}
+		FS.w_close(W);
+	}
+
+	xr_sprintf(fname, sizeof(fname), "%s.json", name);
+	FS.update_path(fname, "$app_data_root$", fname);
+	if (IWriter* W = FS.w_open(fname))
+	{
+		string256 line;
+		W->w_string("{");
+		xr_sprintf(line, "\t\"frames\": %d,", frames - 1);
+		W->w_string(line);
+
+		xr_vector<float> column;
+		column.reserve(frames);
+		for (u32 c = 0; c <= demo_stat_count; ++c)
+		{
+			column.clear();
+			double sum = 0;
+			for (u32 it = 1; it < frames; ++it)
+			{
+				float value = c ? stat_subsystems[it * demo_stat_count + c - 1] : 1000.f * stat_table[it];
+				column.push_back(value);
+				sum += value;
+			}
+			std::sort(column.begin(), column.end());
+
+			xr_sprintf(line, "\t\"%s\": {\"mean\": %.3f, \"p50\": %.3f, \"p90\": %.3f, \"p99\": %.3f, \"max\": %.3f}%s",
+			           c ? demo_stats[c - 1].name : "frame", float(sum / column.size()), percentile(column, .5f),
+			           percentile(column, .9f), percentile(column, .99f), column.back(), c < demo_stat_count ? "," : "");
+			W->w_string(line);
+		}
+		W->w_string("}");
+		FS.w_close(W);
+	}
 }
 
 extern string512 g_sBenchmarkName;
@@ -170,6 +309,7 @@ void CDemoPlay::stat_Stop()
 
 
 		FS.update_path(fname, "$app_data_root$", fname);
+		stat_Export(xr_strlen(g_sBenchmarkName) ? g_sBenchmarkName : "benchmark");
 		CInifile res(fname, FALSE, FALSE, TRUE);
 		res.w_float("general", "renderer", float(::Render->get_generation()) / 10.f, "dx-level required");
 		res.w_float("general", "min", rfps_min, "absolute minimum");
@@ -231,6 +371,8 @@ BOOL CDemoPlay::ProcessCam(SCamEffectorInfo& info)
 	{
 		stat_table.push_back(stat_Timer_frame.GetElapsed_sec());
 		stat_Timer_frame.Start();
+		if (g_bBenchmark)
+			stat_Sample();
 	}
 
 	// Process motion
@@ -29,8 +29,15 @@ class ENGINE_API CDemoPlay : public CEffectorCam
 	u32 stat_StartFrame;
 	xr_vector<float> stat_table;
 
+	// benchmark only: per-subsystem ms per frame, one row per stat_table entry
+	xr_vector<float> stat_subsystems;
+	xr_vector<u64> stat_accum;
+	bool stat_fixed_step;
+
 	void stat_Start();
 	void stat_Stop();
+	void stat_Sample();
+	void stat_Export(LPCSTR name);
 public:
 	virtual BOOL ProcessCam(SCamEffectorInfo& info);
 
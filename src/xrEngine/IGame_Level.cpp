@@ -9,6 +9,7 @@
 #include "gamefont.h"
 #include "xrLevel.h"
 #include "CameraManager.h"
+#include "LoadPipeline.h"
 #include "xr_object.h"
 #include "feel_sound.h"
 
@@ -103,31 +104,60 @@ bool IGame_Level::Load(u32 dwNum)
 	fs.r_chunk_safe(fsL_HEADER, &H, sizeof(H));
 	R_ASSERT2(XRCL_PRODUCTION_VERSION == H.XRLC_version, "Incompatible level version.");
 
-	// CForms
-	// g_pGamePersistent->LoadTitle ("st_loading_cform");
-	g_pGamePersistent->LoadTitle();
-	ObjectSpace.Load(build_callback);
-	//Sound->set_geometry_occ ( &Static );
-	Sound->set_geometry_occ(ObjectSpace.GetStaticModel());
-	Sound->set_handler(_sound_event);
+	// The cform tree is built on a worker while the render loads its geometry, both only need the
+	// spatial DBs which Open sets up. Render queries made meanwhile wait for the tree.
+	CLoadPipeline pipeline("level");
+	bool build_cform = false;
 
-	pApp->LoadSwitch();
+	u32 cform_open = pipeline.add("cform_open", CLoadPipeline::eMain, [&]()
+	{
+		build_cform = ObjectSpace.Open(build_callback);
+	});
 
+	// g_pGamePersistent->LoadTitle ("st_loading_cform");
+	u32 cform_build = pipeline.add("cform_build", CLoadPipeline::eWorker, [&]()
+	{
+		if (build_cform)
+			ObjectSpace.Build();
+	}, true);
+	pipeline.depends(cform_build, cform_open);
 
-	// HUD + Environment
-	if (!g_hud)
-		g_hud = (CCustomHUD*)NEW_INSTANCE(CLSID_HUDMANAGER);
+	u32 cform_close = pipeline.add("cform_close", CLoadPipeline::eMain, [&]()
+	{
+		ObjectSpace.Close();
+		//Sound->set_geometry_occ ( &Static );
+		Sound->set_geometry_occ(ObjectSpace.GetStaticModel());
+		Sound->set_handler(_sound_event);
 
-	// Render-level Load
-	Render->level_Load(LL_Stream);
-	// tscreate.FrameEnd ();
-	// Msg ("* S-CREATE: %f ms, %d times",tscreate.result,tscreate.count);
+		pApp->LoadSwitch();
+	});
+	pipeline.depends(cform_close, cform_build);
 
-	// Objects
-	g_pGamePersistent->Environment().mods_load();
-	R_ASSERT(Load_GameSpecific_Before());
-	Objects.Load();
-	//. ANDY R_ASSERT (Load_GameSpecific_After ());
+	u32 render = pipeline.add("render", CLoadPipeline::eMain, [&]()
+	{
+		// HUD + Environment
+		if (!g_hud)
+			g_hud = (CCustomHUD*)NEW_INSTANCE(CLSID_HUDMANAGER);
+
+		// Render-level Load
+		Render->level_Load(LL_Stream);
+		// tscreate.FrameEnd ();
+		// Msg ("* S-CREATE: %f ms, %d times",tscreate.result,tscreate.count);
+	});
+	pipeline.depends(render, cform_open);
+
+	u32 game = pipeline.add("game", CLoadPipeline::eMain, [&]()
+	{
+		// Objects
+		g_pGamePersistent->Environment().mods_load();
+		R_ASSERT(Load_GameSpecific_Before());
+		Objects.Load();
+		//. ANDY R_ASSERT (Load_GameSpecific_After ());
+	});
+	pipeline.depends(game, cform_close);
+	pipeline.depends(game, render);
+
+	pipeline.run();
 
 	// Done
 	FS.r_close(LL_Stream);
@@ -164,12 +194,16 @@ void IGame_Level::OnRender()
 #endif // _GPA_ENABLED
 
 	// Level render, only when no client output required
-	if (!g_dedicated_server)
+	if (!g_dedicated_server && !g_bBenchmarkNoRender)
 	{
-		Render->Calculate();
+		{
+			TRACE_ZONE("render_calculate");
+			Render->Calculate();
+		}
+		TRACE_ZONE("render_render");
 		Render->Render();
 	}
-	else
+	else if (g_dedicated_server)
 	{
 		Sleep(psNET_DedicatedSleep);
 	}
@@ -0,0 +1,120 @@
+#include "stdafx.h"
+#pragma hdrstop
+
+#include "LoadPipeline.h"
+#include "IGame_Persistent.h"
+
+CLoadPipeline::CLoadPipeline(LPCSTR name) :
+	m_name(name)
+{
+}
+
+CLoadPipeline::~CLoadPipeline()
+{
+	m_tasks.wait();
+	for (xr_vector<SStage*>::iterator I = m_stages.begin(); I != m_stages.end(); ++I)
+		xr_delete(*I);
+}
+
+u32 CLoadPipeline::add(LPCSTR name, EThread thread, const Job& job, bool title)
+{
+	SStage* stage = xr_new<SStage>();
+	stage->name = name;
+	stage->job = job;
+	stage->thread = thread;
+	stage->title = title;
+	stage->started = false;
+	stage->reported = false;
+	stage->finished = 0;
+	stage->time_ms = 0;
+	m_stages.push_back(stage);
+	return m_stages.size() - 1;
+}
+
+void CLoadPipeline::depends(u32 stage, u32 on)
+{
+	VERIFY(on < stage && stage < m_stages.size());
+	m_stages[stage]->depends.push_back(on);
+}
+
+bool CLoadPipeline::ready(const SStage& stage) const
+{
+	for (xr_vector<u32>::const_iterator I = stage.depends.begin(); I != stage.depends.end(); ++I)
+		if (!m_stages[*I]->finished)
+			return false;
+	return true;
+}
+
+void CLoadPipeline::execute(SStage& stage)
+{
+	TRACE_ZONE_DETAIL("load_stage", stage.name);
+	CTimer timer;
+	timer.Start();
+	stage.job();
+	stage.time_ms = timer.GetElapsed_ms();
+	InterlockedExchange(&stage.finished, 1);
+}
+
+void CLoadPipeline::report(SStage& stage)
+{
+	stage.reported = true;
+	Msg("* load stage [%s:%s]: %d ms%s", m_name, stage.name, stage.time_ms, stage.thread == eWorker ? " (worker)" : "");
+	if (stage.title)
+		g_pGamePersistent->LoadTitle();
+}
+
+void CLoadPipeline::run()
+{
+	static bool serial = !!strstr(Core.Params, "-no_mt_load");
+
+	CTimer timer;
+	timer.Start();
+
+	u32 left = m_stages.size();
+	while (left)
+	{
+		bool progress = false;
+
+		// start whatever became ready, main thread stages one at a time so that workers started
+		// by the stage just finished get going before the next one
+		for (xr_vector<SStage*>::iterator I = m_stages.begin(); I != m_stages.end(); ++I)
+		{
+			SStage& stage = **I;
+			if (stage.started || !ready(stage))
+				continue;
+
+			stage.started = true;
+			progress = true;
+
+			if (stage.thread == eWorker && !serial)
+			{
+				m_tasks.run([this, &stage]() { execute(stage); });
+				continue;
+			}
+
+			execute(stage);
+			break;
+		}
+
+		for (xr_vector<SStage*>::iterator I = m_stages.begin(); I != m_stages.end(); ++I)
+		{
+			if ((*I)->finished && !(*I)->reported)
+			{
+				report(**I);
+				--left;
+				progress = true;
+			}
+		}
+
+		if (!progress)
+			Sleep(1);
+	}
+
+	m_tasks.wait();
+
+	u32 total_ms = 0;
+	for (xr_vector<SStage*>::const_iterator I = m_stages.begin(); I != m_stages.end(); ++I)
+		total_ms += (*I)->time_ms;
+
+	Msg("* load pipeline [%s]: %d ms, %d ms in stages", m_name, timer.GetElapsed_ms(), total_ms);
+}
@@ -0,0 +1,55 @@
+#pragma once
+
+#include "../xrcore/xr_parallel.h"
+#include <functional>
+
+// Loading stages with explicit dependencies. Stages bound to the main thread run there in the
+// order they were added, as soon as everything they depend on is done; worker stages are started
+// on the task pool at the same point, so independent work overlaps. Worker stages must not touch
+// FS, the device or anything else owned by the main thread. Every stage is timed and logged,
+// titled stages advance the loading screen when they finish. -no_mt_load runs all of them in order
+// on the main thread.
+class ENGINE_API CLoadPipeline
+{
+public:
+	typedef std::function<void()> Job;
+
+	enum EThread
+	{
+		eMain,
+		eWorker,
+	};
+
+private:
+	struct SStage
+	{
+		LPCSTR name;
+		Job job;
+		EThread thread;
+		bool title;
+		bool started;
+		bool reported;
+		volatile LONG finished;
+		u32 time_ms;
+		xr_vector<u32> depends;
+	};
+
+	LPCSTR m_name;
+	xr_vector<SStage*> m_stages;
+	xr_task_group m_tasks;
+
+	CLoadPipeline(const CLoadPipeline&);
+	void operator=(const CLoadPipeline&);
+
+	bool ready(const SStage& stage) const;
+	void execute(SStage& stage);
+	void report(SStage& stage);
+
+public:
+	CLoadPipeline(LPCSTR name);
+	~CLoadPipeline();
+
+	u32 add(LPCSTR name, EThread thread, const Job& job, bool title = false);
+	void depends(u32 stage, u32 on);
+	void run();
+};
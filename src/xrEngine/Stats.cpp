@@ -308,6 +308,7 @@ void CStats::Show()
 		F.OutNext("*** SOUND:   %2.2fms", Sound.result);
 		F.OutNext("  TGT/SIM/E: %d/%d/%d", snd_stat._rendered, snd_stat._simulated, snd_stat._events);
 		F.OutNext("  HIT/MISS:  %d/%d", snd_stat._cache_hits, snd_stat._cache_misses);
+		F.OutNext("  OCC RAYS:  %d", snd_stat._occlusion_rays);
 		F.OutSkip();
 		F.OutNext("Input:       %2.2fms", Input.result);
 		F.OutNext("clRAY:       %2.2fms, %d, %2.0fK", clRAY.result, clRAY.count, r_ps);
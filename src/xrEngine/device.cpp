@@ -179,9 +179,15 @@ void mt_Thread(void* ptr)
 		mt_Thread_marker = device.dwFrame;
 
 		for (u32 pit = 0; pit < device.seqParallel.size(); pit++)
+		{
+			TRACE_ZONE("seqParallel");
 			device.seqParallel[pit]();
+		}
 		device.seqParallel.clear_not_free();
-		device.seqFrameMT.Process(rp_Frame);
+		{
+			TRACE_ZONE("seqFrameMT");
+			device.seqFrameMT.Process(rp_Frame);
+		}
 
 		// now we give control to device - signals that we are ended our work
 		device.mt_csEnter.Leave();
@@ -302,7 +308,8 @@ void CRenderDevice::on_idle()
 #ifdef DEDICATED_SERVER
     u32 FrameStartTime = TimerGlobal.GetElapsed_ms();
 #endif
-	if (psDeviceFlags.test(rsStatistic))
+	// the benchmark demo reports per-subsystem times
+	if (psDeviceFlags.test(rsStatistic) || g_bBenchmark)
 		g_bEnableStatGather = TRUE;
 	else g_bEnableStatGather = FALSE;
 	if (g_loading_events.size())
@@ -316,6 +323,7 @@ void CRenderDevice::on_idle()
 	if (!Device.dwPrecacheFrame && !g_SASH.IsBenchmarkRunning() && g_bLoaded)
 		g_SASH.StartBenchmark();
 
+	TRACE_ZONE("frame");
 	FrameMove();
 
 	// Precache
@@ -396,6 +404,7 @@ void CRenderDevice::on_idle()
 
 	if (b_is_Active && Begin())
 	{
+		TRACE_ZONE("seqRender");
 		seqRender.Process(rp_Render);
 		if (psDeviceFlags.test(rsCameraPos) || psDeviceFlags.test(rsStatistic) || Statistic->errors.size())
 			Statistic->Show();
@@ -408,15 +417,22 @@ void CRenderDevice::on_idle()
 	// *** Suspend threads
 	// Capture startup point
 	// Release end point - allow thread to wait for startup point
-	mt_csEnter.Enter();
+	{
+		TRACE_ZONE("wait_secondary_thread");
+		mt_csEnter.Enter();
+	}
 	mt_csLeave.Leave();
 
 	// Ensure, that second thread gets chance to execute anyway
 	if (dwFrame != mt_Thread_marker)
 	{
 		for (u32 pit = 0; pit < Device.seqParallel.size(); pit++)
+		{
+			TRACE_ZONE("seqParallel");
 			Device.seqParallel[pit]();
+		}
 		Device.seqParallel.clear_not_free();
+		TRACE_ZONE("seqFrameMT");
 		seqFrameMT.Process(rp_Frame);
 	}
 
@@ -550,7 +566,10 @@ void CRenderDevice::FrameMove()
 	Statistic->EngineTOTAL.Begin();
 	// TODO: HACK to test loading screen.
 	//if(!g_bLoaded)
-	Device.seqFrame.Process(rp_Frame);
+	{
+		TRACE_ZONE("seqFrame");
+		Device.seqFrame.Process(rp_Frame);
+	}
 	g_bLoaded = TRUE;
 	//else
 	// seqFrame.Process(rp_Frame);
@@ -372,6 +372,7 @@ extern ENGINE_API float refresh_rate;
 #endif // ECO_RENDER
 
 extern ENGINE_API bool g_bBenchmark;
+extern ENGINE_API bool g_bBenchmarkNoRender;
 
 typedef fastdelegate::FastDelegate0<bool> LOADING_EVENT;
 extern ENGINE_API xr_list<LOADING_EVENT> g_loading_events;
@@ -151,6 +151,7 @@ static HWND logoWindow = NULL;
 int doLauncher();
 void doBenchmark(LPCSTR name);
 ENGINE_API bool g_bBenchmark = false;
+ENGINE_API bool g_bBenchmarkNoRender = false;
 string512 g_sBenchmarkName;
 
 
@@ -1770,6 +1771,8 @@ void doBenchmark(LPCSTR name)
 		Core.Params = (char*)xr_realloc(Core.Params, cmdSize);
 		xr_strcpy(Core.Params, cmdSize, test_command.c_str());
 		xr_strlwr(Core.Params);
+		// -benchmark_no_render: the run measures the simulation only, the level is not rendered
+		g_bBenchmarkNoRender = !!strstr(Core.Params, "-benchmark_no_render");
 
 		InitInput();
 		if (i)
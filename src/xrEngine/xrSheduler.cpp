@@ -365,7 +365,10 @@ void CSheduler::ProcessStep()
 
 		m_current_step_obj = T.Object;
 		// try {
-		T.Object->shedule_Update(clampr(Elapsed, u32(1), u32(_max(u32(T.Object->shedule.t_max), u32(1000)))));
+		{
+			TRACE_ZONE_DETAIL("shedule_Update", T.scheduled_name.c_str());
+			T.Object->shedule_Update(clampr(Elapsed, u32(1), u32(_max(u32(T.Object->shedule.t_max), u32(1000)))));
+		}
 		if (!m_current_step_obj)
 		{
 #ifdef DEBUG_SCHEDULER
@@ -442,6 +445,7 @@ SwitchToFiber (fiber_main);
 void CSheduler::Update()
 {
 	R_ASSERT(Device.Statistic);
+	TRACE_ZONE("scheduler");
 	// Initialize
 	Device.Statistic->Sheduler.Begin();
 	cycles_start = CPU::QPC();
@@ -476,7 +480,10 @@ void CSheduler::Update()
         VERIFY(T.Object->dbg_startframe != Device.dwFrame);
         T.Object->dbg_startframe = Device.dwFrame;
 #endif
-		T.Object->shedule_Update(Elapsed);
+		{
+			TRACE_ZONE_DETAIL("shedule_Update", T.Object->shedule_Name().c_str());
+			T.Object->shedule_Update(Elapsed);
+		}
 		T.dwTimeOfLastExecute = dwTime;
 	}
 
@@ -234,6 +234,68 @@ public:
 	}
 };
 
+class CCC_HashBenchmark : public IConsole_Command
+{
+public:
+	CCC_HashBenchmark(LPCSTR N) : IConsole_Command(N) { bEmptyArgsHandled = TRUE; };
+
+	virtual void Execute(LPCSTR args)
+	{
+		int size = atoi(args);
+		_hash_benchmark(size > 0 ? u32(size) : 0);
+	}
+};
+
+class CCC_TraceStart : public IConsole_Command
+{
+public:
+	CCC_TraceStart(LPCSTR N) : IConsole_Command(N) { bEmptyArgsHandled = TRUE; };
+
+	virtual void Execute(LPCSTR args)
+	{
+		xr_trace::start();
+		Msg("* trace started");
+	}
+};
+
+class CCC_TraceStop : public IConsole_Command
+{
+public:
+	CCC_TraceStop(LPCSTR N) : IConsole_Command(N) { bEmptyArgsHandled = TRUE; };
+
+	virtual void Execute(LPCSTR args)
+	{
+		xr_trace::stop();
+		Msg("* trace stopped");
+	}
+};
+
+class CCC_TraceDump : public IConsole_Command
+{
+public:
+	CCC_TraceDump(LPCSTR N) : IConsole_Command(N) { bEmptyArgsHandled = TRUE; };
+
+	virtual void Execute(LPCSTR args)
+	{
+		string_path name, file_name;
+		if (args && *args)
+			xr_sprintf(name, "%s.json", args);
+		else
+			xr_sprintf(name, "trace_%d.json", Device.dwFrame);
+
+		FS.update_path(file_name, "$app_data_root$", name);
+		if (xr_trace::dump(file_name))
+			Msg("* trace saved to [%s]", file_name);
+		else
+			Msg("! Can't write trace [%s]", file_name);
+	}
+
+	virtual void Info(TInfo& I)
+	{
+		xr_strcpy(I, "[file name], Chrome trace JSON in $app_data_root$");
+	}
+};
+
 //-----------------------------------------------------------------------
 class CCC_SaveCFG : public IConsole_Command
 {
@@ -998,6 +1060,8 @@ void CCC_Register()
 	CMD1(CCC_Screenmode, "rs_screenmode");
 	CMD3(CCC_Mask, "rs_stats", &psDeviceFlags, rsStatistic);
 	CMD4(CCC_Float, "rs_vis_distance", &psVisDistance, 0.4f, 1.5f);
+	CMD4(CCC_Integer, "weather_cycles_budget", &psWeatherCycles, 2, 64);
+	CMD4(CCC_Integer, "objects_parallel_batch", &psObjectsParallelBatch, 0, 1024);
 
 	CMD3(CCC_Mask, "rs_cam_pos", &psDeviceFlags, rsCameraPos);
 #ifdef DEBUG
@@ -1036,6 +1100,10 @@ void CCC_Register()
 	CMD3(CCC_Mask, "snd_efx", &psSoundFlags, ss_EAX);
 	CMD4(CCC_Integer, "snd_targets", &psSoundTargets, 32, 1024);
 	CMD4(CCC_Integer, "snd_cache_size", &psSoundCacheSizeMB, 8, 256);
+	CMD4(CCC_Integer, "snd_occlusion_budget", &psSoundOcclusionBudget, 1, 256);
+	CMD4(CCC_Integer, "snd_occlusion_max_age", &psSoundOcclusionMaxAge, 1, 300);
+	CMD4(CCC_Float, "snd_occlusion_threshold", &psSoundOcclusionMoveThreshold, 0.f, 10.f);
+	CMD4(CCC_Float, "snd_occlusion_smooth", &psSoundOcclusionSmooth, 0.1f, 10.f);
 	// Doppler effect power
 	CMD4(CCC_Float, "snd_doppler_power", &soundSmoothingParams::power, 0.f, 5.f);
 	CMD4(CCC_SoundParamsSmoothing, "snd_doppler_smoothing", &soundSmoothingParams::steps, 1, 100);
@@ -1077,6 +1145,10 @@ void CCC_Register()
 #ifdef DEBUG
     CMD1(CCC_DumpOpenFiles, "dump_open_files");
 #endif
+	CMD1(CCC_HashBenchmark, "hash_benchmark");
+	CMD1(CCC_TraceStart, "trace_start");
+	CMD1(CCC_TraceStop, "trace_stop");
+	CMD1(CCC_TraceDump, "trace_dump");
 
 	//CMD1(CCC_ExclusiveMode, "input_exclusive_mode");
 
@@ -24,6 +24,14 @@
 
 inline void CObjectList::o_crow(CObject* O)
 {
+	if (m_parallel_update)
+	{
+		xrCriticalSection::raii lock(&m_deferred_lock);
+		m_deferred_crows.push_back(O);
+		O->dwFrame_AsCrow = Device.dwFrame;
+		return;
+	}
+
 	Objects& crows = get_crows();
 	VERIFY(std::find(crows.begin(), crows.end(), O) == crows.end());
 	crows.push_back(O);
@@ -90,6 +90,9 @@ public:
 
 	ICF void IAmNotACrowAnyMore() { Props.crow = false; }
 	virtual BOOL AlwaysTheCrow() { return FALSE; }
+	// UpdateCL touches nothing but the object itself and reads its parent, so CObjectList may
+	// run it on a worker next to other such objects
+	virtual bool UpdateCL_Parallel() { return false; }
 	ICF bool AmICrow() const { return !!Props.crow; }
 
 	// Network
@@ -11,6 +11,8 @@
 
 #include "CustomHUD.h"
 
+#include "../xrcore/xr_parallel.h"
+
 class fClassEQ
 {
 	CLASS_ID cls;
@@ -24,8 +26,11 @@ public:
 BOOL debug_destroy = TRUE;
 #endif
 
+ENGINE_API int psObjectsParallelBatch = 32;
+
 CObjectList::CObjectList() :
-	m_owner_thread_id(GetCurrentThreadId())
+	m_owner_thread_id(GetCurrentThreadId()),
+	m_parallel_update(false)
 {
 	ZeroMemory(map_NETID, 0xffff * sizeof(CObject*));
 }
@@ -125,7 +130,10 @@ void CObjectList::SingleUpdate(CObject* O)
 
 	// Msg ("[%d][0x%08x]IAmNotACrowAnyMore (CObjectList::SingleUpdate)", Device.dwFrame, dynamic_cast<void*>(O));
 
-	O->UpdateCL();
+	{
+		TRACE_ZONE_DETAIL("UpdateCL", O->cName().c_str());
+		O->UpdateCL();
+	}
 #ifdef DEBUG
 	VERIFY3(O->dbg_update_cl == Device.dwFrame, "Broken sequence of calls to 'UpdateCL'", *O->cName());
 #endif
@@ -185,6 +193,88 @@ void CObjectList::SingleUpdate(CObject* O)
 #endif // #ifdef DEBUG
 }
 
+static bool update_skipped(CObject* O)
+{
+	return Device.dwFrame == O->dwFrame_UpdateCL || !O->processing_enabled();
+}
+
+static bool id_less(CObject* O0, CObject* O1)
+{
+	return O0->ID() < O1->ID();
+}
+
+void CObjectList::update_parallel(Objects& batch)
+{
+	// parents go first, as in SingleUpdate; whatever got updated on the way drops out
+	for (Objects::iterator i = batch.begin(); i != batch.end(); ++i)
+		if ((*i)->H_Parent())
+			SingleUpdate((*i)->H_Parent());
+
+	// the serial pass may have made an object unfit since it was collected, e.g. dropped it
+	for (Objects::iterator i = batch.begin(); i != batch.end(); ++i)
+		if (!update_skipped(*i) && !(*i)->UpdateCL_Parallel())
+			SingleUpdate(*i);
+
+	batch.erase(std::remove_if(batch.begin(), batch.end(), update_skipped), batch.end());
+
+	if (batch.size() < u32(psObjectsParallelBatch))
+	{
+		for (Objects::iterator i = batch.begin(); i != batch.end(); ++i)
+			SingleUpdate(*i);
+		return;
+	}
+
+	Device.Statistic->UpdateClient_updated += batch.size();
+	for (Objects::iterator i = batch.begin(); i != batch.end(); ++i)
+		(*i)->dwFrame_UpdateCL = Device.dwFrame;
+
+	u32 const count = batch.size();
+	u32 const grain = _max(u32(8), count / (4 * xr_parallel_workers()));
+
+	m_parallel_update = true;
+	xr_parallel_for(0, count, grain, [&](u32 i)
+	{
+		TRACE_ZONE_DETAIL("UpdateCL", batch[i]->cName().c_str());
+		batch[i]->UpdateCL();
+	});
+	m_parallel_update = false;
+
+	for (Objects::iterator i = batch.begin(); i != batch.end(); ++i)
+	{
+		CObject* O = *i;
+#ifdef DEBUG
+		VERIFY3(O->dbg_update_cl == Device.dwFrame, "Broken sequence of calls to 'UpdateCL'", *O->cName());
+#endif
+		if (O->H_Parent() && (O->H_Parent()->getDestroy() || O->H_Root()->getDestroy()))
+		{
+			Msg("! ERROR: incorrect destroy sequence for object[%d:%s], section[%s], parent[%d:%s]", O->ID(), *O->cName(),
+			    *O->cNameSect(), O->H_Parent()->ID(), *O->H_Parent()->cName());
+		}
+	}
+
+	apply_deferred();
+}
+
+void CObjectList::apply_deferred()
+{
+	// collected in whatever order the workers ran, sorted to keep the next frame reproducible
+	if (!m_deferred_crows.empty())
+	{
+		std::sort(m_deferred_crows.begin(), m_deferred_crows.end(), id_less);
+		Objects& crows = get_crows();
+		crows.insert(crows.end(), m_deferred_crows.begin(), m_deferred_crows.end());
+		m_deferred_crows.clear_not_free();
+	}
+
+	if (!m_deferred_destroy.empty())
+	{
+		std::sort(m_deferred_destroy.begin(), m_deferred_destroy.end(), id_less);
+		for (Objects::iterator i = m_deferred_destroy.begin(); i != m_deferred_destroy.end(); ++i)
+			register_object_to_destroy(*i);
+		m_deferred_destroy.clear_not_free();
+	}
+}
+
 void CObjectList::clear_crow_vec(Objects& o)
 {
 	for (u32 _it = 0; _it < o.size(); _it++)
@@ -244,6 +334,7 @@ void CObjectList::Update(bool bForce)
 				clear_crow_vec(crows);
 			}
 
+			TRACE_ZONE("objects_update");
 			Device.Statistic->UpdateClient.Begin();
 			Device.Statistic->UpdateClient_active = objects_active.size();
 			Device.Statistic->UpdateClient_total = objects_active.size() + objects_sleeping.size();
@@ -262,8 +353,17 @@ void CObjectList::Update(bool bForce)
 				(*i)->dwFrame_AsCrow = u32(-1);
 			}
 
+			m_parallel_batch.clear_not_free();
 			for (CObject** i = b; i != e; ++i)
-				SingleUpdate(*i);
+			{
+				if (psObjectsParallelBatch && (*i)->UpdateCL_Parallel())
+					m_parallel_batch.push_back(*i);
+				else
+					SingleUpdate(*i);
+			}
+
+			if (!m_parallel_batch.empty())
+				update_parallel(m_parallel_batch);
 
 			Device.Statistic->UpdateClient.End();
 		}
@@ -580,6 +680,13 @@ bool CObjectList::dump_all_objects()
 
 void CObjectList::register_object_to_destroy(CObject* object_to_destroy)
 {
+	if (m_parallel_update)
+	{
+		xrCriticalSection::raii lock(&m_deferred_lock);
+		m_deferred_destroy.push_back(object_to_destroy);
+		return;
+	}
+
 #ifdef DEBUG
 	VERIFY(!registered_object_to_destroy(object_to_destroy));
 #endif
@@ -5,6 +5,9 @@
 class ENGINE_API CObject;
 class NET_Packet;
 
+// smallest batch of update-safe objects worth spreading over workers, 0 updates them in order
+ENGINE_API extern int psObjectsParallelBatch;
+
 class ENGINE_API CObjectList
 {
 private:
@@ -22,6 +25,14 @@ private:
 	Objects m_crows[2];
 	u32 m_owner_thread_id;
 
+	// while a parallel batch runs, crows and destroy requests are collected here and applied
+	// on the owner thread once it is over
+	Objects m_parallel_batch;
+	Objects m_deferred_crows;
+	Objects m_deferred_destroy;
+	xrCriticalSection m_deferred_lock;
+	bool m_parallel_update;
+
 public:
 	typedef fastdelegate::FastDelegate1<CObject*> RELCASE_CALLBACK;
 
@@ -103,6 +114,9 @@ private:
 		return (m_crows[1]);
 	}
 
+	void update_parallel(Objects& batch);
+	void apply_deferred();
+
 	static void clear_crow_vec(Objects& o);
 	static void dump_list(Objects& v, LPCSTR reason);
 };
@@ -39,6 +39,7 @@ public:
 	virtual bool shedule_Needed();
 
 	virtual void UpdateCL();
+	virtual bool UpdateCL_Parallel() { return false; }
 	virtual void renderable_Render();
 	virtual void ChangeCondition(float fDeltaCondition) { CInventoryItem::ChangeCondition(fDeltaCondition); };
 	virtual void StartTimerEffects();
@@ -22,6 +22,7 @@ public:
 	virtual void OnH_B_Independent(bool just_before_destroy);
 
 	virtual void UpdateCL();
+	virtual bool UpdateCL_Parallel() { return false; }
 	virtual void renderable_Render();
 
 	float GetGrenadeVel() { return m_fGrenadeVel; }
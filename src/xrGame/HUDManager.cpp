@@ -19,6 +19,7 @@
 
 #include "Flashlight.h"
 #include "Inventory.h"
+#include "ui/UILines.h"
 #include "map_manager.h"
 
 extern CUIGameCustom* CurrentGameUI()
@@ -113,6 +114,7 @@ void CFontManager::InitializeFont(CGameFont*& F, LPCSTR section, u32 flags)
 CFontManager::~CFontManager()
 {
 	Device.seqDeviceReset.Remove(this);
+	CUILines::ClearLayoutCache();
 	FONTS_VEC_IT it = m_all_fonts.begin();
 	FONTS_VEC_IT it_e = m_all_fonts.end();
 	for (; it != it_e; ++it)
@@ -130,6 +132,7 @@ void CFontManager::Render()
 void CFontManager::OnDeviceReset()
 {
 	InitializeFonts();
+	CUILines::ClearLayoutCache();
 }
 
 //--------------------------------------------------------------------
@@ -22,6 +22,7 @@ public:
 	virtual void net_Destroy();
 	virtual void shedule_Update(u32 dt);
 	virtual void UpdateCL();
+	virtual bool UpdateCL_Parallel() { return false; }
 	virtual void renderable_Render();
 
 	virtual void OnH_A_Chield();
@@ -116,6 +116,10 @@ void CInventory::Clear()
 	m_ruck.clear();
 	m_belt.clear();
 
+	m_section_items.clear();
+	m_class_items.clear();
+	m_id_items.clear();
+
 	for (u16 i = FirstSlot(); i <= LastSlot(); i++)
 		m_slots[i].m_pIItem = NULL;
 
@@ -141,6 +145,7 @@ void CInventory::Take(CGameObject* pObj, bool bNotActivate, bool strict_placemen
 	Level().RemoveObject_From_4CrPr(pObj);
 
 	m_all.push_back(pIItem);
+	IndexItem(pIItem);
 
 	if (!strict_placement)
 		pIItem->m_ItemCurrPlace.type = eItemPlaceUndefined;
@@ -265,6 +270,7 @@ bool CInventory::DropItem(CGameObject* pObj, bool just_before_destroy, bool dont
 			if (temp_iter != m_ruck.end())
 			{
 				m_ruck.erase(temp_iter);
+				IndexRuck(pIItem, false);
 			}
 			else
 			{
@@ -305,7 +311,10 @@ bool CInventory::DropItem(CGameObject* pObj, bool just_before_destroy, bool dont
 	};
 	TIItemContainer::iterator it = std::find(m_all.begin(), m_all.end(), pIItem);
 	if (it != m_all.end())
+	{
 		m_all.erase(it);
+		UnindexItem(pIItem);
+	}
 	else
 		Msg("! CInventory::Drop item not found in inventory!!!");
 
@@ -387,6 +396,7 @@ bool CInventory::Slot(u16 slot_id, PIItem pIItem, bool bNotActivate, bool strict
 		if (it_ruck != m_ruck.end())
 		{
 			m_ruck.erase(it_ruck);
+			IndexRuck(pIItem, false);
 			R_ASSERT(it_belt == m_belt.end());
 		}
 		else if (it_belt != m_belt.end())
@@ -409,7 +419,10 @@ bool CInventory::Slot(u16 slot_id, PIItem pIItem, bool bNotActivate, bool strict
 	else
 	{
 		if (it_ruck != m_ruck.end())
+		{
 			m_ruck.erase(it_ruck);
+			IndexRuck(pIItem, false);
+		}
 		if (it_belt != m_belt.end())
 			m_belt.erase(it_belt);
 	}
@@ -462,7 +475,10 @@ bool CInventory::Belt(PIItem pIItem, bool strict_placement)
 	{
 		TIItemContainer::iterator it = std::find(m_ruck.begin(), m_ruck.end(), pIItem);
 		if (m_ruck.end() != it)
+		{
 			m_ruck.erase(it);
+			IndexRuck(pIItem, false);
+		}
 	}
 
 	CalcTotalWeight();
@@ -528,6 +544,7 @@ bool CInventory::Ruck(PIItem pIItem, bool strict_placement)
 	}
 
 	m_ruck.insert(m_ruck.end(), pIItem);
+	IndexRuck(pIItem, true);
 
 	CalcTotalWeight();
 	InvalidateState();
@@ -1013,13 +1030,16 @@ PIItem CInventory::GetAny(LPCSTR name) const
 
 PIItem CInventory::item(CLASS_ID cls_id) const
 {
-	const TIItemContainer& list = m_all;
+	CLASS_ITEMS::const_iterator I = m_class_items.find(cls_id);
+	if (I == m_class_items.end())
+		return NULL;
+
+	const TIItemContainer& list = (*I).second.m_items;
 
 	for (TIItemContainer::const_iterator it = list.begin(); list.end() != it; ++it)
 	{
 		PIItem pIItem = *it;
-		if (pIItem->object().CLS_ID == cls_id &&
-			pIItem->Useful())
+		if (pIItem->Useful())
 			return pIItem;
 	}
 	return NULL;
@@ -1042,57 +1062,88 @@ float CInventory::CalcTotalWeight()
 	return m_fTotalWeight;
 }
 
+void CInventory::IndexItem(PIItem pIItem)
+{
+	PIItem& indexed = m_id_items[pIItem->object().ID()];
+	VERIFY(!indexed);
+	indexed = pIItem;
 
-u32 CInventory::dwfGetSameItemCount(LPCSTR caSection, bool SearchAll)
+	m_section_items[pIItem->object().cNameSect()].m_items.push_back(pIItem);
+	m_class_items[pIItem->object().CLS_ID].m_items.push_back(pIItem);
+}
+
+void CInventory::UnindexItem(PIItem pIItem)
+{
+	ID_ITEMS::iterator I = m_id_items.find(pIItem->object().ID());
+	VERIFY(I != m_id_items.end());
+	m_id_items.erase(I);
+
+	SECTION_ITEMS::iterator S = m_section_items.find(pIItem->object().cNameSect());
+	VERIFY(S != m_section_items.end());
+	(*S).second.m_items.erase(std::find((*S).second.m_items.begin(), (*S).second.m_items.end(), pIItem));
+	if ((*S).second.m_items.empty())
+		m_section_items.erase(S);
+
+	CLASS_ITEMS::iterator C = m_class_items.find(pIItem->object().CLS_ID);
+	VERIFY(C != m_class_items.end());
+	(*C).second.m_items.erase(std::find((*C).second.m_items.begin(), (*C).second.m_items.end(), pIItem));
+	if ((*C).second.m_items.empty())
+		m_class_items.erase(C);
+}
+
+void CInventory::IndexRuck(PIItem pIItem, bool in_ruck)
 {
-	u32 l_dwCount = 0;
-	TIItemContainer& l_list = SearchAll ? m_all : m_ruck;
-	for (TIItemContainer::iterator l_it = l_list.begin(); l_list.end() != l_it; ++l_it)
+	SItemGroup& section = m_section_items[pIItem->object().cNameSect()];
+	SItemGroup& cls = m_class_items[pIItem->object().CLS_ID];
+	VERIFY(in_ruck || (section.m_ruck_count && cls.m_ruck_count));
+
+	if (in_ruck)
 	{
-		PIItem l_pIItem = *l_it;
-		if (!xr_strcmp(l_pIItem->object().cNameSect(), caSection))
-			++l_dwCount;
+		++section.m_ruck_count;
+		++cls.m_ruck_count;
 	}
+	else
+	{
+		--section.m_ruck_count;
+		--cls.m_ruck_count;
+	}
+}
+
+u32 CInventory::ClassItemCount(CLASS_ID cls_id, bool SearchAll) const
+{
+	CLASS_ITEMS::const_iterator I = m_class_items.find(cls_id);
+	if (I == m_class_items.end())
+		return (0);
 
-	return (l_dwCount);
+	return (SearchAll ? (*I).second.m_items.size() : (*I).second.m_ruck_count);
 }
 
-u32 CInventory::dwfGetGrenadeCount(LPCSTR caSection, bool SearchAll)
+u32 CInventory::dwfGetSameItemCount(LPCSTR caSection, bool SearchAll)
 {
-	u32 l_dwCount = 0;
-	TIItemContainer& l_list = SearchAll ? m_all : m_ruck;
-	for (TIItemContainer::iterator l_it = l_list.begin(); l_list.end() != l_it; ++l_it)
-	{
-		PIItem l_pIItem = *l_it;
-		if (l_pIItem->object().CLS_ID == CLSID_GRENADE_F1 || l_pIItem->object().CLS_ID == CLSID_GRENADE_RGD5)
-			++l_dwCount;
-	}
+	SECTION_ITEMS::const_iterator I = m_section_items.find(shared_str(caSection));
+	if (I == m_section_items.end())
+		return (0);
 
-	return (l_dwCount);
+	return (SearchAll ? (*I).second.m_items.size() : (*I).second.m_ruck_count);
+}
+
+u32 CInventory::dwfGetGrenadeCount(LPCSTR caSection, bool SearchAll)
+{
+	return (ClassItemCount(CLSID_GRENADE_F1, SearchAll) + ClassItemCount(CLSID_GRENADE_RGD5, SearchAll));
 }
 
 bool CInventory::bfCheckForObject(ALife::_OBJECT_ID tObjectID)
 {
-	TIItemContainer& l_list = m_all;
-	for (TIItemContainer::iterator l_it = l_list.begin(); l_list.end() != l_it; ++l_it)
-	{
-		PIItem l_pIItem = *l_it;
-		if (l_pIItem->object().ID() == tObjectID)
-			return (true);
-	}
-	return (false);
+	return (m_id_items.find(tObjectID) != m_id_items.end());
 }
 
 CInventoryItem* CInventory::get_object_by_id(ALife::_OBJECT_ID tObjectID)
 {
-	TIItemContainer& l_list = m_all;
-	for (TIItemContainer::iterator l_it = l_list.begin(); l_list.end() != l_it; ++l_it)
-	{
-		PIItem l_pIItem = *l_it;
-		if (l_pIItem->object().ID() == tObjectID)
-			return (l_pIItem);
-	}
-	return (0);
+	ID_ITEMS::const_iterator I = m_id_items.find(tObjectID);
+	if (I == m_id_items.end())
+		return (0);
+
+	return ((*I).second);
 }
 
 //  
@@ -1272,28 +1323,17 @@ CInventoryItem* CInventory::tpfGetObjectByIndex(int iIndex)
 
 CInventoryItem* CInventory::GetItemFromInventory(LPCSTR caItemName)
 {
-	TIItemContainer& l_list = m_all;
-
-	u32 crc = crc32(caItemName, xr_strlen(caItemName));
+	SECTION_ITEMS::const_iterator I = m_section_items.find(shared_str(caItemName));
+	if (I == m_section_items.end())
+		return (0);
 
-	for (TIItemContainer::iterator l_it = l_list.begin(); l_list.end() != l_it; ++l_it)
-		if ((*l_it)->object().cNameSect()._get()->dwCRC == crc)
-		{
-			VERIFY(0 == xr_strcmp( (*l_it)->object().cNameSect().c_str(), caItemName));
-			return (*l_it);
-		}
-	return (0);
+	VERIFY(!(*I).second.m_items.empty());
+	return ((*I).second.m_items.front());
 }
 
 CInventoryItem* CInventory::GetItemFromInventory(u16 id)
 {
-	TIItemContainer& l_list = m_all;
-
-	for (TIItemContainer::iterator l_it = l_list.begin(); l_list.end() != l_it; ++l_it)
-		if ((*l_it)->object().ID() == id)
-			return (*l_it);
-
-	return (0);
+	return (get_object_by_id(id));
 }
 
 bool CInventory::CanTakeItem(CInventoryItem* inventory_item) const
@@ -1305,10 +1345,8 @@ bool CInventory::CanTakeItem(CInventoryItem* inventory_item) const
 
 	if (!inventory_item->CanTake()) return false;
 
-	TIItemContainer::const_iterator it;
-	for (it = m_all.begin(); it != m_all.end(); it++)
-		if ((*it)->object().ID() == inventory_item->object().ID()) break;
-	VERIFY3(it == m_all.end(), "item already exists in inventory", *inventory_item->object().cName());
+	VERIFY3(m_id_items.find(inventory_item->object().ID()) == m_id_items.end(), "item already exists in inventory",
+	        *inventory_item->object().cName());
 
 	CActor* pActor = smart_cast<CActor*>(m_pOwner);
 	//    
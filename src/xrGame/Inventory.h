@@ -186,6 +186,31 @@ protected:
 
 	void SendActionEvent(u16 cmd, u32 flags);
 
+private:
+	// m_all indexed by section, class and id, kept up to date by Take, Drop and every change of
+	// m_ruck. Items of a group follow the m_all order, so the first one is the one a scan over
+	// m_all would find.
+	struct SItemGroup
+	{
+		TIItemContainer m_items;
+		u32 m_ruck_count;
+
+		SItemGroup() : m_ruck_count(0) {}
+	};
+
+	typedef xr_map<shared_str, SItemGroup> SECTION_ITEMS;
+	typedef xr_map<CLASS_ID, SItemGroup> CLASS_ITEMS;
+	typedef xr_map<u16, PIItem> ID_ITEMS;
+
+	SECTION_ITEMS m_section_items;
+	CLASS_ITEMS m_class_items;
+	ID_ITEMS m_id_items;
+
+	void IndexItem(PIItem pIItem);
+	void UnindexItem(PIItem pIItem);
+	void IndexRuck(PIItem pIItem, bool in_ruck);
+	u32 ClassItemCount(CLASS_ID cls_id, bool SearchAll) const;
+
 private:
 	priority_group* m_slot2_priorities[qs_priorities_count];
 	priority_group* m_slot3_priorities[qs_priorities_count];
@@ -15,6 +15,7 @@
 #include "material_manager.h"
 #include "Weapon.h"
 
+#include "../xrcore/xr_parallel.h"
 #include "../Include/xrRender/UIRender.h"
 #include "../Include/xrRender/Kinematics.h"
 
@@ -313,12 +314,30 @@ void CBulletManager::UpdateWorkload()
 {
 	//	VERIFY						( m_thread_id == GetCurrentThreadId() );
 
+	TRACE_ZONE("bullets");
+
 	rq_storage.r_clear();
 
 	u32 const time_delta = Device.dwTimeDelta;
 	if (!time_delta)
 		return;
 
+	u32 const bullet_delta = u32(time_delta * g_bullet_time_factor);
+
+	// ray queries into ObjectSpace are serialized by its lock and the dynamic part runs script and
+	// sound callbacks, so only what depends on nothing but the bullet itself goes wide: the first
+	// segment is picked and cast against the static geometry, and the serial pass below skips the
+	// static test for segments that are known to be clear
+	u32 const bullet_count = m_Bullets.size();
+	u32 const bullets_per_task = 16;
+	m_plans.resize(bullet_count);
+	xr_parallel_for(0, (bullet_count + bullets_per_task - 1) / bullets_per_task, [&](u32 task)
+	{
+		CDB::COLLIDER collider;
+		for (u32 k = task * bullets_per_task, n = _min(k + bullets_per_task, bullet_count); k < n; ++k)
+			plan_bullet(collider, m_Bullets[k], bullet_delta, m_plans[k]);
+	});
+
 	collide::rq_result dummy;
 
 	// this is because of ugly nature of removing bullets
@@ -329,7 +348,7 @@ void CBulletManager::UpdateWorkload()
 	BulletVec::reverse_iterator e = m_Bullets.rend();
 	for (u16 j = u16(e - i); i != e; ++i, --j)
 	{
-		if (process_bullet(rq_storage, *i, u32(time_delta * g_bullet_time_factor)))
+		if (process_bullet(rq_storage, *i, bullet_delta, &m_plans[j - 1]))
 			continue;
 
 		VERIFY(j > 0);
@@ -852,6 +871,31 @@ BOOL CBulletManager::firetrace_callback(collide::rq_result& result, LPVOID param
 	return (FALSE);
 }
 
+// the planner and the serial pass must cast exactly the same ray, both get it from here
+static bool trajectory_segment(
+	SBullet const& bullet,
+	float const low,
+	float const high,
+	Fvector const& gravity,
+	float const air_resistance,
+	Fvector& start,
+	Fvector& direction,
+	float& distance
+)
+{
+	Fvector const& position = bullet.start_position;
+	Fvector const& velocity = bullet.start_velocity;
+	start = trajectory_position(position, velocity, gravity, air_resistance, low);
+	Fvector const target = trajectory_position(position, velocity, gravity, air_resistance, high);
+	direction.sub(target, start);
+	distance = direction.magnitude();
+	if (fis_zero(distance))
+		return (false);
+
+	direction.mul(1.f / distance);
+	return (true);
+}
+
 bool CBulletManager::trajectory_check_error(
 	Fvector& previous_position,
 	collide::rq_results& storage,
@@ -859,20 +903,15 @@ bool CBulletManager::trajectory_check_error(
 	float& low,
 	float& high,
 	Fvector const& gravity,
-	float const air_resistance
+	float const air_resistance,
+	collide::rq_target const target
 )
 {
-	Fvector const& position = bullet.start_position;
-	Fvector const& velocity = bullet.start_velocity;
-	Fvector const start = trajectory_position(position, velocity, gravity, air_resistance, low);
-	Fvector const target = trajectory_position(position, velocity, gravity, air_resistance, high);
-	Fvector start_to_target = Fvector().sub(target, start);
-	float const distance = start_to_target.magnitude();
-	if (fis_zero(distance))
+	Fvector start, start_to_target;
+	float distance;
+	if (!trajectory_segment(bullet, low, high, gravity, air_resistance, start, start_to_target, distance))
 		return (true);
 
-	start_to_target.mul(1.f / distance);
-
 	bullet_test_callback_data data;
 	data.pBullet = &bullet;
 #if 1//def DEBUG
@@ -881,7 +920,7 @@ bool CBulletManager::trajectory_check_error(
 	bullet.flags.ricochet_was = 0;
 	bullet.dir = start_to_target;
 
-	collide::ray_defs RD(start, start_to_target, distance, CDB::OPT_FULL_TEST, collide::rqtBoth);
+	collide::ray_defs RD(start, start_to_target, distance, CDB::OPT_FULL_TEST, target);
 	BOOL const result = Level().ObjectSpace.RayQuery(storage, RD, CBulletManager::firetrace_callback, &data,
 	                                                 CBulletManager::test_callback, NULL);
 	if (!result || (data.collide_time == 0.f))
@@ -983,7 +1022,37 @@ static bool try_update_bullet(SBullet& bullet, Fvector const& gravity, float con
 }
 
 
-bool CBulletManager::process_bullet(collide::rq_results& storage, SBullet& bullet, u32 const delta_time)
+void CBulletManager::plan_bullet(CDB::COLLIDER& collider, SBullet& bullet, u32 const delta_time, SBulletPlan& plan)
+{
+	plan.valid = false;
+	if (bullet.speed < 1.f)
+		return;
+
+	float const time_delta = float(delta_time) / 1000.f;
+	Fvector const gravity = Fvector().set(0.f, -m_fGravityConst, 0.f);
+	float const air_resistance = (GameID() == eGameIDSingle) ? m_fAirResistanceK : bullet.air_resistance;
+
+	plan.low = bullet.life_time;
+	plan.high = bullet.life_time + time_delta;
+	plan.time = trajectory_select_pick_time(bullet, plan.low, plan.high, gravity, air_resistance);
+	plan.valid = true;
+
+	Fvector start, direction;
+	float distance;
+	if (plan.time == plan.low ||
+		!trajectory_segment(bullet, plan.low, plan.time, gravity, air_resistance, start, direction, distance))
+	{
+		plan.static_clear = false;
+		return;
+	}
+
+	collider.ray_options(CDB::OPT_FULL_TEST);
+	collider.ray_query(Level().ObjectSpace.GetStaticModel(), start, direction, distance);
+	plan.static_clear = !collider.r_count();
+}
+
+bool CBulletManager::process_bullet(collide::rq_results& storage, SBullet& bullet, u32 const delta_time,
+                                    SBulletPlan const* plan)
 {
 	float const time_delta = float(delta_time) / 1000.f;
 	Fvector const gravity = Fvector().set(0.f, -m_fGravityConst, 0.f);
@@ -1027,13 +1096,19 @@ bool CBulletManager::process_bullet(collide::rq_results& storage, SBullet& bulle
 			if (bullet.change_rajectory_count >= 32)
 				return (false);
 
-			float time = trajectory_select_pick_time(bullet, low, high, gravity, air_resistance);
+			// only the first segment was planned, everything after it depends on this pass
+			bool const planned = plan && plan->valid && plan->low == low && plan->high == high;
+			float time = planned ? plan->time : trajectory_select_pick_time(bullet, low, high, gravity, air_resistance);
+			collide::rq_target const target = planned && plan->static_clear ? collide::rqtObject : collide::rqtBoth;
+			plan = NULL;
+
 			if (time == low)
 				return (false);
 
 			float safe_time = time;
 			VERIFY2(safe_time <= high, make_string("safe_time[%f], high[%f]", safe_time, high));
-			if (!trajectory_check_error(previous_position, storage, bullet, low, time, gravity, air_resistance))
+			if (!trajectory_check_error(previous_position, storage, bullet, low, time, gravity, air_resistance,
+			                            target))
 			{
 				VERIFY2(safe_time >= time, make_string("safe_time[%f], time[%f]", safe_time, time));
 				VERIFY2(safe_time <= high, make_string("safe_time[%f], high[%f]", safe_time, high));
@@ -143,6 +143,17 @@ private:
 		u16 tgt_material;
 	};
 
+	// first trajectory segment of a bullet for the coming update, picked and tested against the
+	// static geometry ahead of the serial pass
+	struct SBulletPlan
+	{
+		float low;
+		float high;
+		float time;
+		bool valid;
+		bool static_clear;
+	};
+
 	static void CalculateNewVelocity(Fvector& dest_new_vel, Fvector const& old_velocity, float ar, float life_time);
 protected:
 	SoundVec m_WhineSounds;
@@ -154,6 +165,7 @@ protected:
 	BulletVec m_Bullets; // working set, locked
 	BulletVec m_BulletsRendered; // copy for rendering
 	xr_vector<_event> m_Events;
+	xr_vector<SBulletPlan> m_plans;
 
 #ifdef DEBUG
 	u32						m_thread_id;
@@ -220,7 +232,8 @@ protected:
 		float& low,
 		float& high,
 		Fvector const& gravity,
-		float const air_resistance
+		float const air_resistance,
+		collide::rq_target const target
 	);
 	void add_bullet_point(
 		Fvector const& start_position,
@@ -230,10 +243,17 @@ protected:
 		float const ait_resistance,
 		float const current_time
 	);
+	void plan_bullet(
+		CDB::COLLIDER& collider,
+		SBullet& bullet,
+		u32 delta_time,
+		SBulletPlan& plan
+	);
 	bool process_bullet(
 		collide::rq_results& rq_storage,
 		SBullet& bullet,
-		u32 delta_time
+		u32 delta_time,
+		SBulletPlan const* plan
 	);
 	void __stdcall UpdateWorkload();
 public:
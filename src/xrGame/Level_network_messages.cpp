@@ -69,7 +69,6 @@ void CLevel::ClientReceive()
 	if (SimmulateNetworkLag())
 		return;
 #endif
-	StartProcessQueue();
 	for (NET_Packet* P = net_msg_Retreive(); P; P = net_msg_Retreive())
 	{
 		if (IsDemoSaveStarted())
@@ -495,7 +494,6 @@ void CLevel::ClientReceive()
 
 		net_msg_Release();
 	}
-	EndProcessQueue();
 
 	if (g_bDebugEvents) ProcessGameSpawns();
 }
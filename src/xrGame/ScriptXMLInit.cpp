@@ -49,15 +49,21 @@ LPCSTR clearBOM(LPCSTR s) {
 
 // demonized
 // Send XML file contents to Lua for edit
-void XMLLuaCallback(CXml &m_xml, LPCSTR xml_string) {
+// Returns true if the script changed the text and the document was loaded from its version
+bool XMLLuaCallback(CXml &m_xml, LPCSTR xml_string) {
 	xml_string = clearBOM(xml_string);
 	luabind::functor<LPCSTR> funct;
 	if (ai().script_engine().functor("_G.COnXmlRead", funct))
 	{
 		LPCSTR res = funct(m_xml.m_xml_file_name, xml_string);
 		//Msg("XMLLuaCallback, xml %s, contents %s", m_xml.m_xml_file_name, res);
+		if (!res || res == xml_string || !xr_strcmp(res, xml_string))
+			return false;
+
 		m_xml.LoadFromString(res);
+		return true;
 	}
+	return false;
 }
 
 void CScriptXmlInit::ParseFile(LPCSTR xml_file)
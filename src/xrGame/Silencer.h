@@ -22,5 +22,6 @@ public:
 	virtual void OnH_B_Independent(bool just_before_destroy);
 
 	virtual void UpdateCL();
+	virtual bool UpdateCL_Parallel() { return false; }
 	virtual void renderable_Render();
 };
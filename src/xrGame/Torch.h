@@ -58,6 +58,7 @@ public:
 	virtual void OnMoveToSlot(const SInvItemPlace& prev);
 	virtual void OnMoveToRuck(const SInvItemPlace& prev);
 	virtual void UpdateCL();
+	virtual bool UpdateCL_Parallel() { return false; }
 
 	void Switch();
 	void Switch(bool light_on);
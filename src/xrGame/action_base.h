@@ -68,6 +68,7 @@ public:
 	IC CActionBase(_object_type* object, LPCSTR action_name = "");
 	virtual ~CActionBase();
 	IC void init(_object_type* object, LPCSTR action_name);
+	using inherited::setup;
 	virtual void setup(_object_type* object, CPropertyStorage* storage);
 	virtual void initialize();
 	virtual void execute();
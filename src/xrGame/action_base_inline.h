@@ -175,7 +175,10 @@ IC const typename CBaseAction::_value_type&CBaseAction::property(const _conditio
 TEMPLATE_SPECIALIZATION
 IC void CBaseAction::set_weight(const _edge_value_type& weight)
 {
-	m_weight = _max(min_weight(), weight);
+	_edge_value_type value = _max(min_weight(), weight);
+	if (m_weight != value)
+		actual(false);
+	m_weight = value;
 }
 
 TEMPLATE_SPECIALIZATION
@@ -22,6 +22,9 @@ public:
 		std::less<
 			ALife::_OBJECT_ID
 		>,
+		false,
+		u64,
+		true,
 		false
 	> OBJECT_REGISTRY;
 
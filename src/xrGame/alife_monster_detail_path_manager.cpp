@@ -29,6 +29,7 @@ CALifeMonsterDetailPathManager::CALifeMonsterDetailPathManager(object_type* obje
 	m_destination.m_level_vertex_id = this->object().get_object().m_tNodeID;
 	m_destination.m_position = this->object().get_object().o_Position;
 	m_walked_distance = 0.f;
+	m_prefetched = false;
 }
 
 void CALifeMonsterDetailPathManager::target(const GameGraph::_GRAPH_ID& game_vertex_id, const u32& level_vertex_id,
@@ -110,31 +111,99 @@ void CALifeMonsterDetailPathManager::update()
 	//	if (ai().game_graph().vertex(object().m_tGraphID)->level_id() == ai().level_graph().level_id())
 	//		Msg							("[detail::update][%6d][%s]",Device.dwTimeGlobal,object().name_replace());
 
+	if (defer_search())
+		return;
+
 	ALife::_TIME_ID time_delta = current_time - m_last_update_time;
 	update(time_delta);
 	// we advisedly "lost" time we need to process a query to avoid some undesirable effects
 	m_last_update_time = ai().alife().time_manager().game_time();
+	m_prefetched = false;
 }
 
-void CALifeMonsterDetailPathManager::make_inactual()
+// While the schedule registry collects deferred searches, an update that would search the path
+// inline leaves the object where it is and keeps its update time, the search runs on a worker after
+// the pass and the next update follows the path for the time of both. update() takes the result if
+// start, destination and terrain are still the ones it was searched for, when the brain has picked
+// another task in the meantime the path is searched inline, so an object waits one update at most.
+xr_vector<ALife::_OBJECT_ID>* CALifeMonsterDetailPathManager::deferred_searches = NULL;
+
+bool CALifeMonsterDetailPathManager::defer_search()
 {
-	m_path.clear();
+	if (!deferred_searches)
+		return (false);
+
+	if (!m_last_update_time || completed() || actual() || m_prefetched)
+		return (false);
+
+	deferred_searches->push_back(object().get_object().ID);
+	return (true);
 }
 
-void CALifeMonsterDetailPathManager::actualize()
+void CALifeMonsterDetailPathManager::search_deferred(CGraphEngine& graph_engine)
 {
-	m_path.clear();
+	m_prefetched_from = object().get_object().m_tGraphID;
+	m_prefetched_to = m_destination.m_game_vertex_id;
+	m_prefetched_terrain = object().m_tpaTerrain;
+	m_prefetched_failed = !search(graph_engine, m_prefetched_path);
+	m_prefetched = true;
+}
+
+bool CALifeMonsterDetailPathManager::prefetched() const
+{
+	if (!m_prefetched)
+		return (false);
+
+	if (m_prefetched_from != object().get_object().m_tGraphID)
+		return (false);
+
+	if (m_prefetched_to != m_destination.m_game_vertex_id)
+		return (false);
+
+	const GameGraph::TERRAIN_VECTOR& terrain = object().m_tpaTerrain;
+	if (m_prefetched_terrain.size() != terrain.size())
+		return (false);
+
+	if (!terrain.empty() && memcmp(&m_prefetched_terrain.front(), &terrain.front(), terrain.size() * sizeof(terrain.front())))
+		return (false);
+
+	return (true);
+}
+
+bool CALifeMonsterDetailPathManager::search(CGraphEngine& graph_engine, PATH& path) const
+{
+	path.clear();
 
 	typedef GraphEngineSpace::CGameVertexParams CGameVertexParams;
 	CGameVertexParams temp = CGameVertexParams(object().m_tpaTerrain);
-	bool failed =
-		!ai().graph_engine().search(
+	return (
+		graph_engine.search(
 			ai().game_graph(),
 			object().get_object().m_tGraphID,
 			m_destination.m_game_vertex_id,
-			&m_path,
+			&path,
 			temp
-		);
+		)
+	);
+}
+
+void CALifeMonsterDetailPathManager::make_inactual()
+{
+	m_path.clear();
+}
+
+void CALifeMonsterDetailPathManager::actualize()
+{
+	bool failed;
+	if (prefetched())
+	{
+		m_path.swap(m_prefetched_path);
+		failed = m_prefetched_failed;
+	}
+	else
+		failed = !search(ai().graph_engine(), m_path);
+
+	m_prefetched = false;
 
 #ifdef DEBUG
 	if (failed) {
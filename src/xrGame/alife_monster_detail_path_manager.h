@@ -14,6 +14,7 @@
 
 class CMovementManagerHolder;
 class CALifeSmartTerrainTask;
+class CGraphEngine;
 
 class CALifeMonsterDetailPathManager
 {
@@ -48,6 +49,17 @@ private:
 	// efficiently implemented in std::vector
 
 private:
+	PATH m_prefetched_path;
+	GameGraph::_GRAPH_ID m_prefetched_from;
+	GameGraph::_GRAPH_ID m_prefetched_to;
+	GameGraph::TERRAIN_VECTOR m_prefetched_terrain;
+	bool m_prefetched_failed;
+	bool m_prefetched;
+
+private:
+	bool search(CGraphEngine& graph_engine, PATH& path) const;
+	bool prefetched() const;
+	bool defer_search();
 	void actualize();
 	void setup_current_speed();
 	void follow_path(const ALife::_TIME_ID& time_delta);
@@ -65,6 +77,10 @@ public:
 
 public:
 	void update();
+	// searches the path a deferred update needs, touches only the prefetch and the given engine
+	void search_deferred(CGraphEngine& graph_engine);
+	// set by the schedule registry while its batch is updated, collects objects to search_deferred
+	static xr_vector<ALife::_OBJECT_ID>* deferred_searches;
 	void on_switch_online();
 	void on_switch_offline();
 	IC void speed(const float& speed);
@@ -66,11 +66,14 @@ void CALifeObjectRegistry::save(IWriter& memory_stream)
 	u32 position = memory_stream.tell();
 	memory_stream.w_u32(u32(-1));
 
+	// walk the ids rather than the packed storage to keep saves in id order
 	u32 object_count = 0;
-	OBJECT_REGISTRY::iterator I = m_objects.begin();
-	OBJECT_REGISTRY::iterator E = m_objects.end();
-	for (; I != E; ++I)
+	for (u32 id = 0; id < u32(ALife::_OBJECT_ID(-1)); ++id)
 	{
+		OBJECT_REGISTRY::iterator I = m_objects.find(ALife::_OBJECT_ID(id));
+		if (I == m_objects.end())
+			continue;
+
 		if (!(*I).second->can_save())
 			continue;
 
@@ -141,6 +144,7 @@ void CALifeObjectRegistry::load(IReader& file_stream)
 	m_objects.clear();
 
 	u32 count = file_stream.r_u32();
+	m_objects.reserve(count);
 	for (u32 I = 0; I < count; ++I)
 	{
 		CSE_ALifeDynamicObject* tpSE_Abstract = get_object(file_stream);
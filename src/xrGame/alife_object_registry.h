@@ -10,6 +10,7 @@
 
 #include "xrServer_Objects_ALife.h"
 #include "profiler.h"
+#include "dense_id_map.h"
 
 #pragma warning(push)
 #pragma warning(disable:4995)
@@ -19,7 +20,7 @@
 class CALifeObjectRegistry
 {
 public:
-	typedef xr_map<ALife::_OBJECT_ID, CSE_ALifeDynamicObject*> OBJECT_REGISTRY;
+	typedef CDenseIdMap<ALife::_OBJECT_ID, CSE_ALifeDynamicObject> OBJECT_REGISTRY;
 
 protected:
 	OBJECT_REGISTRY m_objects;
@@ -18,19 +18,16 @@ IC void CALifeObjectRegistry::add(CSE_ALifeDynamicObject* object)
 		       "Object with the specified ID is already presented in the Object Registry!");
 	}
 
-	m_objects.insert(std::make_pair(object->ID, object));
+	m_objects.insert(object->ID, object);
 }
 
 IC void CALifeObjectRegistry::remove(const ALife::_OBJECT_ID& id, bool no_assert)
 {
-	OBJECT_REGISTRY::iterator I = m_objects.find(id);
-	if (I == m_objects.end())
+	if (!m_objects.erase(id))
 	{
 		THROW2(no_assert, "The specified object hasn't been found in the Object Registry!");
 		return;
 	}
-
-	m_objects.erase(I);
 }
 
 IC CSE_ALifeDynamicObject* CALifeObjectRegistry::object(const ALife::_OBJECT_ID& id, bool no_assert) const
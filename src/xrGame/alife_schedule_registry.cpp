@@ -8,9 +8,150 @@
 
 #include "stdafx.h"
 #include "alife_schedule_registry.h"
+#include "xrServer_Objects_ALife_Monsters.h"
+#include "alife_monster_brain.h"
+#include "alife_monster_movement_manager.h"
+#include "alife_monster_detail_path_manager.h"
+#include "alife_online_offline_group_brain.h"
+#include "alife_simulator.h"
+#include "alife_object_registry.h"
+#include "ai_space.h"
+#include "game_graph.h"
+#include "graph_engine.h"
+#include "mt_config.h"
+#include "object_broker.h"
+#include "../xrcore/xr_parallel.h"
+
+// searches a job should get at least, smaller batches are not worth the dispatch
+static const u32 min_partition_size = 8;
 
 CALifeScheduleRegistry::~CALifeScheduleRegistry()
 {
+	delete_data(m_graph_engines);
+}
+
+void CALifeScheduleRegistry::update()
+{
+	if (objects().empty())
+		return;
+
+	if (!g_mt_config.test(mtALifeParallel))
+	{
+		inherited::update(CUpdatePredicate(m_objects_per_update), false);
+		return;
+	}
+
+	m_batch.clear_not_free();
+	inherited::update(CUpdatePredicate(m_objects_per_update, &m_batch), false);
+	update_batch();
+}
+
+// Every object of the batch gets its usual update() in schedule order. An update that has to search a
+// game path does not do it inline: it keeps the object in place and hands its id to m_searches. These
+// searches then run in parallel, partitioned by game vertex, each job with its own graph engine, they
+// only read the game graph and write the path to the object's prefetch. The next update of the object
+// takes it and follows the path for the time of both updates.
+void CALifeScheduleRegistry::update_batch()
+{
+	m_searches.clear_not_free();
+	CALifeMonsterDetailPathManager::deferred_searches = &m_searches;
+
+	BATCH::const_iterator I = m_batch.begin();
+	BATCH::const_iterator E = m_batch.end();
+	for (; I != E; ++I)
+	{
+		// an earlier update may have released it
+		CSE_ALifeSchedulable* schedulable = object(*I, true);
+		if (!schedulable)
+			continue;
+
+		START_PROFILE("ALife/scheduled/update")
+			schedulable->update();
+		STOP_PROFILE
+	}
+
+	CALifeMonsterDetailPathManager::deferred_searches = NULL;
+
+	START_PROFILE("ALife/scheduled/search")
+		search_paths();
+	STOP_PROFILE
+}
+
+static CALifeMonsterDetailPathManager* detail_path_manager(CSE_ALifeDynamicObject* object)
+{
+	CSE_ALifeMonsterAbstract* monster = smart_cast<CSE_ALifeMonsterAbstract*>(object);
+	if (monster)
+		return (&monster->brain().movement().detail());
+
+	CSE_ALifeOnlineOfflineGroup* group = smart_cast<CSE_ALifeOnlineOfflineGroup*>(object);
+	if (group)
+		return (&group->brain().movement().detail());
+
+	return (0);
+}
+
+void CALifeScheduleRegistry::search_paths()
+{
+	if (m_searches.empty())
+		return;
+
+	std::sort(m_searches.begin(), m_searches.end());
+	m_searches.erase(std::unique(m_searches.begin(), m_searches.end()), m_searches.end());
+
+	m_partition.clear_not_free();
+	BATCH::const_iterator I = m_searches.begin();
+	BATCH::const_iterator E = m_searches.end();
+	for (; I != E; ++I)
+	{
+		// an update later in the batch may have released it
+		CSE_ALifeDynamicObject* object = ai().alife().objects().object(*I, true);
+		if (!object)
+			continue;
+
+		CALifeMonsterDetailPathManager* detail = detail_path_manager(object);
+		VERIFY(detail);
+
+		SPartitionItem item;
+		item.m_detail = detail;
+		item.m_game_vertex_id = object->m_tGraphID;
+		item.m_id = *I;
+		m_partition.push_back(item);
+	}
+
+	u32 count = m_partition.size();
+	u32 job_count = _min(xr_parallel_workers(), count / min_partition_size);
+	if (job_count < 2)
+	{
+		// the objects wait for these paths, so they are searched here even if a batch is too small to split
+		for (u32 i = 0; i < count; ++i)
+			m_partition[i].m_detail->search_deferred(ai().graph_engine());
+		return;
+	}
+
+	std::sort(m_partition.begin(), m_partition.end());
+
+	// cut into nearly equal ranges, moving each cut to a vertex boundary
+	m_bounds.clear_not_free();
+	m_bounds.push_back(0);
+	for (u32 job = 1; job < job_count; ++job)
+	{
+		u32 bound = _max(m_bounds.back(), job * count / job_count);
+		while (bound && (bound < count) &&
+			(m_partition[bound].m_game_vertex_id == m_partition[bound - 1].m_game_vertex_id))
+			++bound;
+		m_bounds.push_back(bound);
+	}
+	m_bounds.push_back(count);
+
+	while (m_graph_engines.size() < job_count)
+		m_graph_engines.push_back(xr_new<CGraphEngine>(ai().game_graph().header().vertex_count()));
+
+	xr_parallel_for(0, job_count, [&](u32 job)
+	{
+		CGraphEngine& graph_engine = *m_graph_engines[job];
+		for (u32 i = m_bounds[job], n = m_bounds[job + 1]; i < n; ++i)
+			m_partition[i].m_detail->search_deferred(graph_engine);
+	});
 }
 
 void CALifeScheduleRegistry::add(CSE_ALifeDynamicObject* object)
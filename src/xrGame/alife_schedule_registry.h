@@ -13,19 +13,26 @@
 #include "ai_debug.h"
 #include "profiler.h"
 
+class CGraphEngine;
+class CALifeMonsterDetailPathManager;
+
 class CALifeScheduleRegistry : public CSafeMapIterator<
 		ALife::_OBJECT_ID, CSE_ALifeSchedulable, std::less<ALife::_OBJECT_ID>, false>
 {
 private:
+	typedef xr_vector<ALife::_OBJECT_ID> BATCH;
+
 	struct CUpdatePredicate
 	{
 		u32 m_count;
 		mutable u32 m_current;
+		BATCH* m_batch;
 
-		IC CUpdatePredicate(const u32& count)
+		IC CUpdatePredicate(const u32& count, BATCH* batch = 0)
 		{
 			m_count = count;
 			m_current = 0;
+			m_batch = batch;
 		}
 
 		IC bool operator()(_iterator& i, u64 cycle_count, bool) const
@@ -44,24 +51,58 @@ private:
 
 		IC void operator()(_iterator& i, u64 cycle_count) const
 		{
+			if (m_batch)
+			{
+				m_batch->push_back((*i).first);
+				return;
+			}
+
 			START_PROFILE("ALife/scheduled/update")
 				(*i).second->update();
 			STOP_PROFILE
 		}
 	};
 
+	struct SPartitionItem
+	{
+		GameGraph::_GRAPH_ID m_game_vertex_id;
+		ALife::_OBJECT_ID m_id;
+		CALifeMonsterDetailPathManager* m_detail;
+
+		IC bool operator<(const SPartitionItem& other) const
+		{
+			if (m_game_vertex_id != other.m_game_vertex_id)
+				return (m_game_vertex_id < other.m_game_vertex_id);
+			return (m_id < other.m_id);
+		}
+	};
+
+	typedef xr_vector<SPartitionItem> PARTITION;
+	typedef xr_vector<CGraphEngine*> GRAPH_ENGINES;
+
 protected:
 	typedef CSafeMapIterator<ALife::_OBJECT_ID, CSE_ALifeSchedulable, std::less<ALife::_OBJECT_ID>, false> inherited;
 
 protected:
 	u32 m_objects_per_update;
 
+private:
+	BATCH m_batch;
+	BATCH m_searches;
+	PARTITION m_partition;
+	xr_vector<u32> m_bounds;
+	GRAPH_ENGINES m_graph_engines;
+
+private:
+	void update_batch();
+	void search_paths();
+
 public:
 	IC CALifeScheduleRegistry();
 	virtual ~CALifeScheduleRegistry();
 	void add(CSE_ALifeDynamicObject* object);
 	void remove(CSE_ALifeDynamicObject* object, bool no_assert = false);
-	IC void update();
+	void update();
 	IC CSE_ALifeSchedulable* object(const ALife::_OBJECT_ID& id, bool no_assert = false) const;
 	IC const u32& objects_per_update() const;
 	IC void objects_per_update(const u32& objects_per_update);
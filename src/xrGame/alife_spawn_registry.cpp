@@ -153,6 +153,12 @@ void CALifeSpawnRegistry::load(IReader& file_stream, xrGUID* save_guid)
 	R_ASSERT2((header().graph_guid() == ai().game_graph().header().guid()) || ignore_save_incompatibility(),
 	          "Spawn doesn't correspond to the graph : REBUILD SPAWN!");
 
+	if (!load_spawn_headers())
+	{
+		build_spawn_headers();
+		save_spawn_headers();
+	}
+
 	build_story_spawns();
 
 	build_root_spawns();
@@ -230,11 +236,108 @@ void CALifeSpawnRegistry::build_story_spawns()
 	SPAWN_GRAPH::const_vertex_iterator E = m_spawns.vertices().end();
 	for (; I != E; ++I)
 	{
-		CSE_ALifeObject* object = smart_cast<CSE_ALifeObject*>(&(*I).second->data()->object());
-		VERIFY(object);
-		if (object->m_spawn_story_id == INVALID_SPAWN_STORY_ID)
+		const SPAWN_HEADER& spawn = (*I).second->data()->header();
+		if (spawn.spawn_story_id == INVALID_SPAWN_STORY_ID)
 			continue;
 
-		m_spawn_story_ids.insert(std::make_pair(object->m_spawn_story_id, (*I).first));
+		m_spawn_story_ids.insert(std::make_pair(spawn.spawn_story_id, (*I).first));
 	}
 }
+
+// Spawn objects are created on first access. What the registry itself needs from every spawn point
+// (spawn id, spawn flags, story id) is cached per spawn file in $app_data_root$, so only the first
+// run of a given spawn creates all of them.
+
+static const u32 spawn_headers_magic = MAKEFOURCC('S', 'P', 'W', 'H');
+static const u32 spawn_headers_version = 1;
+
+void CALifeSpawnRegistry::build_spawn_headers()
+{
+	SPAWN_GRAPH::const_vertex_iterator I = m_spawns.vertices().begin();
+	SPAWN_GRAPH::const_vertex_iterator E = m_spawns.vertices().end();
+	for (; I != E; ++I)
+		(*I).second->data()->build_header();
+}
+
+void CALifeSpawnRegistry::spawn_headers_file_name(string_path& file_name) const
+{
+	string_path name;
+	xr_sprintf(name, "spawn_cache\\%s.spwh", *m_spawn_name);
+	FS.update_path(file_name, "$app_data_root$", name);
+}
+
+bool CALifeSpawnRegistry::load_spawn_headers()
+{
+	if (strstr(Core.Params, "-no_spawn_cache") || !FS.path_exist("$app_data_root$") || !m_spawn_name.size())
+		return (false);
+
+	string_path file_name;
+	spawn_headers_file_name(file_name);
+	if (!FS.exist(file_name))
+		return (false);
+
+	IReader* stream = FS.r_open(file_name);
+	if (!stream)
+		return (false);
+
+	const u32 record_size = 2 * sizeof(u16) + 2 * sizeof(u32);
+	bool result =
+		(stream->length() >= int(3 * sizeof(u32) + sizeof(xrGUID))) &&
+		(stream->r_u32() == spawn_headers_magic) &&
+		(stream->r_u32() == spawn_headers_version);
+
+	if (result)
+	{
+		xrGUID guid;
+		stream->r(&guid, sizeof(guid));
+		result = (guid == header().guid()) &&
+			(stream->r_u32() == m_spawns.vertex_count()) &&
+			(u32(stream->elapsed()) == m_spawns.vertex_count() * record_size);
+	}
+
+	if (result)
+	{
+		SPAWN_GRAPH::const_vertex_iterator I = m_spawns.vertices().begin();
+		SPAWN_GRAPH::const_vertex_iterator E = m_spawns.vertices().end();
+		for (; result && (I != E); ++I)
+		{
+			result = (stream->r_u16() == (*I).first);
+
+			SPAWN_HEADER spawn;
+			spawn.spawn_id = stream->r_u16();
+			spawn.spawn_story_id = stream->r_u32();
+			spawn.spawn_flags.assign(stream->r_u32());
+			(*I).second->data()->header(spawn);
+		}
+	}
+
+	FS.r_close(stream);
+	return (result);
+}
+
+void CALifeSpawnRegistry::save_spawn_headers() const
+{
+	if (strstr(Core.Params, "-no_spawn_cache") || !FS.path_exist("$app_data_root$") || !m_spawn_name.size())
+		return;
+
+	CMemoryWriter stream;
+	stream.w_u32(spawn_headers_magic);
+	stream.w_u32(spawn_headers_version);
+	stream.w(&header().guid(), sizeof(header().guid()));
+	stream.w_u32(m_spawns.vertex_count());
+
+	SPAWN_GRAPH::const_vertex_iterator I = m_spawns.vertices().begin();
+	SPAWN_GRAPH::const_vertex_iterator E = m_spawns.vertices().end();
+	for (; I != E; ++I)
+	{
+		const SPAWN_HEADER& spawn = (*I).second->data()->header();
+		stream.w_u16((*I).first);
+		stream.w_u16(spawn.spawn_id);
+		stream.w_u32(spawn.spawn_story_id);
+		stream.w_u32(spawn.spawn_flags.get());
+	}
+
+	string_path file_name;
+	spawn_headers_file_name(file_name);
+	stream.save_to(file_name);
+}
@@ -23,6 +23,7 @@ class CALifeSpawnRegistry : CRandom
 public:
 	typedef CGameGraph::LEVEL_POINT_VECTOR ARTEFACT_SPAWNS;
 	typedef CGraphAbstractSerialize<CServerEntityWrapper*, float, ALife::_SPAWN_ID> SPAWN_GRAPH;
+	typedef CServerEntityWrapper::SHeader SPAWN_HEADER;
 
 public:
 	typedef xr_vector<ALife::_SPAWN_ID> SPAWN_IDS;
@@ -48,6 +49,10 @@ protected:
 	void load_updates(IReader& stream);
 	void build_story_spawns();
 	void build_root_spawns();
+	void build_spawn_headers();
+	void spawn_headers_file_name(string_path& file_name) const;
+	bool load_spawn_headers();
+	void save_spawn_headers() const;
 	void fill_new_spawns_single(SPAWN_GRAPH::CVertex* vertex, xr_vector<ALife::_SPAWN_ID>& spawns,
 	                            ALife::_TIME_ID game_time, xr_vector<ALife::_SPAWN_ID>& objects);
 	void fill_new_spawns(SPAWN_GRAPH::CVertex* vertex, xr_vector<ALife::_SPAWN_ID>& spawns, ALife::_TIME_ID game_time,
@@ -55,13 +60,13 @@ protected:
 	IC void process_spawns(xr_vector<ALife::_SPAWN_ID>& spawns);
 	IC bool redundant(CSE_Abstract& abstract);
 	IC bool new_spawn(CSE_Abstract& abstract);
-	IC bool enabled_spawn(CSE_Abstract& abstract) const;
-	IC bool count_limit(CSE_Abstract& abstract) const;
-	IC bool time_limit(CSE_Abstract& abstract, ALife::_TIME_ID game_time) const;
-	IC bool spawned_item(CSE_Abstract& abstract, xr_vector<ALife::_SPAWN_ID>& objects) const;
+	IC bool enabled_spawn(const SPAWN_HEADER& spawn) const;
+	IC bool count_limit(const SPAWN_HEADER& spawn) const;
+	IC bool time_limit(const SPAWN_HEADER& spawn, ALife::_TIME_ID game_time) const;
+	IC bool spawned_item(const SPAWN_HEADER& spawn, xr_vector<ALife::_SPAWN_ID>& objects) const;
 	IC bool spawned_item(SPAWN_GRAPH::CVertex* vertex, xr_vector<ALife::_SPAWN_ID>& objects);
-	IC bool object_existance_limit(CSE_Abstract& abstract, xr_vector<ALife::_SPAWN_ID>& objects) const;
-	IC bool can_spawn(CSE_Abstract& abstract, ALife::_TIME_ID game_time, xr_vector<ALife::_SPAWN_ID>& objects) const;
+	IC bool object_existance_limit(const SPAWN_HEADER& spawn, xr_vector<ALife::_SPAWN_ID>& objects) const;
+	IC bool can_spawn(const SPAWN_HEADER& spawn, ALife::_TIME_ID game_time, xr_vector<ALife::_SPAWN_ID>& objects) const;
 
 public:
 	CALifeSpawnRegistry(LPCSTR section);
@@ -10,14 +10,14 @@
 #include "alife_spawn_registry.h"
 #include "random32.h"
 
-IC bool CALifeSpawnRegistry::enabled_spawn(CSE_Abstract& abstract) const
+IC bool CALifeSpawnRegistry::enabled_spawn(const SPAWN_HEADER& spawn) const
 {
-	return (!!abstract.m_spawn_flags.is(CSE_Abstract::flSpawnEnabled));
+	return (!!spawn.spawn_flags.is(CSE_Abstract::flSpawnEnabled));
 }
 
-IC bool CALifeSpawnRegistry::count_limit(CSE_Abstract& abstract) const
+IC bool CALifeSpawnRegistry::count_limit(const SPAWN_HEADER& spawn) const
 {
-	if (!!abstract.m_spawn_flags.is(CSE_Abstract::flSpawnInfiniteCount))
+	if (!!spawn.spawn_flags.is(CSE_Abstract::flSpawnInfiniteCount))
 		return (false);
 
 	//	if (abstract.m_spawn_count < abstract.m_max_spawn_count)
@@ -26,9 +26,9 @@ IC bool CALifeSpawnRegistry::count_limit(CSE_Abstract& abstract) const
 	return (true);
 }
 
-IC bool CALifeSpawnRegistry::time_limit(CSE_Abstract& abstract, ALife::_TIME_ID game_time) const
+IC bool CALifeSpawnRegistry::time_limit(const SPAWN_HEADER& spawn, ALife::_TIME_ID game_time) const
 {
-	if (!!abstract.m_spawn_flags.is(CSE_Abstract::flSpawnOnSurgeOnly))
+	if (!!spawn.spawn_flags.is(CSE_Abstract::flSpawnOnSurgeOnly))
 		return (false);
 
 	//	if (game_time >= abstract.m_next_spawn_time)
@@ -37,16 +37,16 @@ IC bool CALifeSpawnRegistry::time_limit(CSE_Abstract& abstract, ALife::_TIME_ID
 	return (true);
 }
 
-IC bool CALifeSpawnRegistry::spawned_item(CSE_Abstract& abstract, SPAWN_IDS& objects) const
+IC bool CALifeSpawnRegistry::spawned_item(const SPAWN_HEADER& spawn, SPAWN_IDS& objects) const
 {
-	SPAWN_IDS::iterator I = std::lower_bound(objects.begin(), objects.end(), abstract.m_tSpawnID);
-	return ((I != objects.end()) && (*I == abstract.m_tSpawnID));
+	SPAWN_IDS::iterator I = std::lower_bound(objects.begin(), objects.end(), spawn.spawn_id);
+	return ((I != objects.end()) && (*I == spawn.spawn_id));
 }
 
 IC bool CALifeSpawnRegistry::spawned_item(SPAWN_GRAPH::CVertex* vertex, SPAWN_IDS& objects)
 {
 	if (vertex->edges().empty())
-		return (spawned_item(vertex->data()->object(), objects));
+		return (spawned_item(vertex->data()->header(), objects));
 
 	SPAWN_GRAPH::const_iterator I = vertex->edges().begin();
 	SPAWN_GRAPH::const_iterator E = vertex->edges().end();
@@ -57,31 +57,31 @@ IC bool CALifeSpawnRegistry::spawned_item(SPAWN_GRAPH::CVertex* vertex, SPAWN_ID
 	return (false);
 }
 
-IC bool CALifeSpawnRegistry::object_existance_limit(CSE_Abstract& abstract, SPAWN_IDS& objects) const
+IC bool CALifeSpawnRegistry::object_existance_limit(const SPAWN_HEADER& spawn, SPAWN_IDS& objects) const
 {
-	if (!abstract.m_spawn_flags.is(CSE_Abstract::flSpawnIfDestroyedOnly))
+	if (!spawn.spawn_flags.is(CSE_Abstract::flSpawnIfDestroyedOnly))
 		return (false);
 
-	if (spawned_item(abstract, objects))
+	if (spawned_item(spawn, objects))
 		return (true);
 
 	return (false);
 }
 
-IC bool CALifeSpawnRegistry::can_spawn(CSE_Abstract& abstract, ALife::_TIME_ID game_time, SPAWN_IDS& objects) const
+IC bool CALifeSpawnRegistry::can_spawn(const SPAWN_HEADER& spawn, ALife::_TIME_ID game_time, SPAWN_IDS& objects) const
 {
 	return (
-		enabled_spawn(abstract) &&
-		!count_limit(abstract) &&
-		!time_limit(abstract, game_time) &&
-		!object_existance_limit(abstract, objects)
+		enabled_spawn(spawn) &&
+		!count_limit(spawn) &&
+		!time_limit(spawn, game_time) &&
+		!object_existance_limit(spawn, objects)
 	);
 }
 
 void CALifeSpawnRegistry::fill_new_spawns_single(SPAWN_GRAPH::CVertex* vertex, SPAWN_IDS& spawns,
                                                  ALife::_TIME_ID game_time, SPAWN_IDS& objects)
 {
-	if (!!vertex->data()->object().m_spawn_flags.is(CSE_Abstract::flSpawnIfDestroyedOnly) && spawned_item(
+	if (!!vertex->data()->header().spawn_flags.is(CSE_Abstract::flSpawnIfDestroyedOnly) && spawned_item(
 		vertex, objects))
 		return;
 
@@ -116,17 +116,18 @@ void CALifeSpawnRegistry::fill_new_spawns(SPAWN_GRAPH::CVertex* vertex, SPAWN_ID
                                           SPAWN_IDS& objects)
 {
 	VERIFY(vertex);
-	if (!can_spawn(vertex->data()->object(), game_time, objects))
+	const SPAWN_HEADER& spawn = vertex->data()->header();
+	if (!can_spawn(spawn, game_time, objects))
 		return;
 
 	if (vertex->edges().empty())
 	{
 		//		vertex->data()->object().m_spawn_count++;
-		spawns.push_back(vertex->data()->object().m_tSpawnID);
+		spawns.push_back(spawn.spawn_id);
 		return;
 	}
 
-	if (!!vertex->data()->object().m_spawn_flags.is(CSE_Abstract::flSpawnSingleItemOnly))
+	if (!!spawn.spawn_flags.is(CSE_Abstract::flSpawnSingleItemOnly))
 	{
 		fill_new_spawns_single(vertex, spawns, game_time, objects);
 		return;
@@ -112,6 +112,7 @@ float g_head_bob_factor = 1.00f;
 float streff;
 
 extern BOOL g_ai_die_in_anomaly; //Alundaio
+extern BOOL g_ai_crowd_avoidance;
 
 extern BOOL g_telekinetic_objects_include_corpses; // Tosox
 
@@ -156,7 +157,7 @@ BOOL g_bCheckTime = FALSE;
 int net_cl_inputupdaterate = 50;
 Flags32 g_mt_config = {
 	mtLevelPath | mtDetailPath | mtObjectHandler | mtSoundPlayer | mtAiVision | mtBullets | mtLUA_GC | mtLevelSounds |
-	mtALife | mtMap
+	mtALife | mtALifeParallel | mtMap
 };
 #ifdef DEBUG
 Flags32	dbg_net_Draw_Flags = { 0 };
@@ -1054,8 +1055,7 @@ public:
 
 	virtual void Execute(LPCSTR)
 	{
-		LogFile->clear_not_free();
-		FlushLog();
+		ClearLog();
 		Msg("* Log file has been cleaned successfully!");
 	}
 };
@@ -2330,6 +2330,7 @@ void CCC_RegisterCommands()
 	CMD3(CCC_Mask, "mt_alife", &g_mt_config, mtALife);
 	CMD3(CCC_Mask, "mt_map", &g_mt_config, mtMap);
 #endif // MASTER_GOLD
+	CMD3(CCC_Mask, "mt_alife_parallel", &g_mt_config, mtALifeParallel);
 
 #ifndef MASTER_GOLD
 	CMD3(CCC_Mask, "ai_obstacles_avoiding", &psAI_Flags, aiObstaclesAvoiding);
@@ -2433,6 +2434,8 @@ void CCC_RegisterCommands()
 	// Physics
 	CMD1(CCC_PHFps, "ph_frequency");
 	CMD1(CCC_PHIterations, "ph_iterations");
+	CMD4(CCC_Integer, "ph_parallel_islands", &ph_console::ph_parallel_islands, 0, 1);
+	CMD4(CCC_Integer, "ph_sap_broadphase", &ph_console::ph_sap_broadphase, 0, 1);
 
 #ifdef DEBUG
 	CMD1(CCC_PHGravity, "ph_gravity");
@@ -2692,6 +2695,8 @@ void CCC_RegisterCommands()
 
 	CMD4(CCC_Integer, "ai_die_in_anomaly", &g_ai_die_in_anomaly, 0, 1); //Alundaio
 
+	CMD4(CCC_Integer, "ai_crowd_avoidance", &g_ai_crowd_avoidance, 0, 1);
+
 	CMD4(CCC_Integer, "pseudogiant_can_damage_objects_on_stomp", &pseudogiantCanDamageObjects, 0, 1);
 
 	CMD4(CCC_Integer, "telekinetic_objects_include_corpses", &g_telekinetic_objects_include_corpses, 0, 1); // Tosox
@@ -2790,6 +2795,7 @@ void CCC_RegisterCommands()
 
 	// Timestamps in log
 	CMD4(CCC_Integer, "log_timestamps", &logTimestamps, 0, 1);
+	CMD4(CCC_Integer, "log_max_size", &psLogMaxSize, 0, 4095);
 
 	// Freelook
 	CMD4(CCC_Float, "freelook_cam_limit", &f_Freelook_cam_limit, 0.f, PI);
@@ -16,9 +16,14 @@
 #include "smart_cover_loophole.h"
 #include "smart_cover_storage.h"
 #include "smart_cover_object.h"
+#include "../xrcore/xr_parallel.h"
 
 #define MIN_COVER_VALUE 16
 
+// static covers depend on the level graph only, their vertices are cached per graph guid
+static const u32 cover_cache_magic = MAKEFOURCC('C', 'O', 'V', 'R');
+static const u32 cover_cache_version = 1;
+
 CCoverManager::CCoverManager()
 {
 	m_covers = 0;
@@ -81,50 +86,147 @@ IC bool CCoverManager::critical_cover(u32 index)
 	);
 }
 
+bool CCoverManager::load_static_cover(LPCSTR file_name, xr_vector<u32>& vertices) const
+{
+	if (!FS.exist(file_name))
+		return false;
+
+	IReader* F = FS.r_open(file_name);
+	if (!F)
+		return false;
+
+	CLevelGraph::CHeader const& header = ai().level_graph().header();
+	xrGUID guid;
+
+	// the header only, the vertex count is checked against the rest below
+	bool result = F->length() >= int(4 * sizeof(u32) + sizeof(guid))
+		&& F->r_u32() == cover_cache_magic
+		&& F->r_u32() == cover_cache_version
+		&& F->r_u32() == header.vertex_count();
+
+	if (result)
+	{
+		F->r(&guid, sizeof(guid));
+		result = (guid == header.guid());
+	}
+
+	if (result)
+	{
+		u32 count = F->r_u32();
+		result = (F->elapsed() == int(count * sizeof(u32)));
+		if (result)
+		{
+			vertices.resize(count);
+			if (count)
+				F->r(&vertices.front(), count * sizeof(u32));
+		}
+	}
+
+	FS.r_close(F);
+	return result;
+}
+
+void CCoverManager::save_static_cover(LPCSTR file_name, xr_vector<u32> const& vertices) const
+{
+	CLevelGraph::CHeader const& header = ai().level_graph().header();
+
+	CMemoryWriter W;
+	W.w_u32(cover_cache_magic);
+	W.w_u32(cover_cache_version);
+	W.w_u32(header.vertex_count());
+	W.w(&header.guid(), sizeof(xrGUID));
+	W.w_u32(vertices.size());
+	if (!vertices.empty())
+		W.w(&vertices.front(), vertices.size() * sizeof(u32));
+	W.save_to(file_name);
+}
+
 void CCoverManager::compute_static_cover()
 {
 	clear();
 	xr_delete(m_covers);
 	m_covers = xr_new<CPointQuadTree>(ai().level_graph().header().box(), ai().level_graph().header().cell_size() * .5f,
 	                                  8 * 65536, 4 * 65536);
-	m_temp.resize(ai().level_graph().header().vertex_count());
 
 	CLevelGraph const& graph = ai().level_graph();
 	u32 n = ai().level_graph().header().vertex_count();
-	for (u32 i = 0; i < n; ++i)
+
+	bool use_cache = FS.path_exist("$app_data_root$") && !strstr(Core.Params, "-no_cover_cache");
+	string_path cache_name;
+	if (use_cache)
 	{
-		CLevelGraph::CVertex const& vertex = *graph.vertex(i);
-		if (vertex.high_cover(0) + vertex.high_cover(1) + vertex.high_cover(2) + vertex.high_cover(3))
-		{
-			m_temp[i] = edge_vertex(i);
-			continue;
-		}
+		xrGUID const& guid = graph.header().guid();
+		string_path name;
+		xr_sprintf(name, "cover_cache\\%016I64x%016I64x.covers", guid.g[0], guid.g[1]);
+		FS.update_path(cache_name, "$app_data_root$", name);
+	}
 
-		if (vertex.low_cover(0) + vertex.low_cover(1) + vertex.low_cover(2) + vertex.low_cover(3))
+	xr_vector<u32> vertices;
+	if (!use_cache || !load_static_cover(cache_name, vertices))
+	{
+		// both passes only read the graph, every vertex writes its own flag; the second pass reads
+		// the flags of the neighbours, so it has to wait for the first one to finish
+		m_temp.resize(n);
+		xr_parallel_for(0, n, 4096, [&](u32 i)
 		{
-			m_temp[i] = edge_vertex(i);
-			continue;
-		}
+			CLevelGraph::CVertex const& vertex = *graph.vertex(i);
+			if (vertex.high_cover(0) + vertex.high_cover(1) + vertex.high_cover(2) + vertex.high_cover(3))
+			{
+				m_temp[i] = edge_vertex(i);
+				return;
+			}
+
+			if (vertex.low_cover(0) + vertex.low_cover(1) + vertex.low_cover(2) + vertex.low_cover(3))
+			{
+				m_temp[i] = edge_vertex(i);
+				return;
+			}
+
+			m_temp[i] = false;
+		});
+
+		xr_vector<u8> critical(n);
+		xr_parallel_for(0, n, 4096, [&](u32 i)
+		{
+			critical[i] = m_temp[i] && critical_cover(i);
+		});
+
+		for (u32 i = 0; i < n; ++i)
+			if (critical[i])
+				vertices.push_back(i);
 
-		m_temp[i] = false;
+		if (use_cache)
+			save_static_cover(cache_name, vertices);
 	}
 
-	for (u32 i = 0; i < n; ++i)
-		if (m_temp[i] && critical_cover(i))
-			m_covers->insert(xr_new<CCoverPoint>(ai().level_graph().vertex_position(ai().level_graph().vertex(i)), i));
+	// static covers live in one block, inserted in vertex order as before
+	m_static_covers.clear();
+	m_static_covers.reserve(vertices.size());
+	for (xr_vector<u32>::const_iterator I = vertices.begin(); I != vertices.end(); ++I)
+	{
+		m_static_covers.push_back(CCoverPoint(graph.vertex_position(graph.vertex(*I)), *I));
+		m_covers->insert(&m_static_covers.back());
+	}
 
 	VERIFY(!m_smart_covers_storage);
 	m_smart_covers_storage = xr_new<smart_cover::storage>();
 }
 
-void CCoverManager::clear_covers(PointVector& covers)
+void CCoverManager::clear_covers(PointVector& covers) const
 {
+	CCoverPoint const* static_begin = m_static_covers.empty() ? 0 : &m_static_covers.front();
+	CCoverPoint const* static_end = static_begin + m_static_covers.size();
+
 	PointVector::iterator I = covers.begin();
 	PointVector::iterator E = covers.end();
 	for (; I != E; ++I)
 	{
 		if (!(*I)->m_is_smart_cover)
 		{
+			// owned by m_static_covers
+			if (*I >= static_begin && *I < static_end)
+				continue;
+
 			xr_delete(*I);
 			continue;
 		}
@@ -144,6 +246,7 @@ void CCoverManager::clear()
 	covers().all(m_nearest);
 	clear_covers(m_nearest);
 	m_covers->clear();
+	m_static_covers.clear();
 	xr_delete(m_smart_covers_storage);
 	m_smart_covers.clear();
 }
@@ -41,8 +41,9 @@ public:
 
 protected:
 	CPointQuadTree* m_covers;
-	xr_vector<bool> m_temp;
+	xr_vector<u8> m_temp;
 	mutable PointVector m_nearest;
+	xr_vector<CCoverPoint> m_static_covers;
 
 private:
 	Storage* m_smart_covers_storage;
@@ -61,7 +62,9 @@ private:
 	IC bool inertia(Fvector const& position, float radius, _evaluator_type& evaluator,
 	                const _restrictor_type& restrictor) const;
 
-	static void clear_covers(PointVector& covers);
+	void clear_covers(PointVector& covers) const;
+	bool load_static_cover(LPCSTR file_name, xr_vector<u32>& vertices) const;
+	void save_static_cover(LPCSTR file_name, xr_vector<u32> const& vertices) const;
 	void remove_nearby_covers(smart_cover::cover const& cover, smart_cover::object const& object) const;
 	void actualize_smart_covers() const;
 
@@ -0,0 +1,65 @@
+////////////////////////////////////////////////////////////////////////////
+//	Module 		: dense_id_map.h
+//	Created 	: 19.10.2026
+//  Modified 	: 19.10.2026
+//	Description : Dense id-indexed map with packed storage
+////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+// Values live in one packed array of (id, value) pairs, so iteration touches contiguous memory
+// and add/remove are O(1): removal moves the last pair into the freed position. The id -> position
+// index is a flat table when ids are dense and the map is expected to hold many of them,
+// otherwise a hash map, which keeps small per-vertex registries small.
+// Iteration order is the insertion order disturbed by removals, not the id order.
+template <
+	typename _key_type,
+	typename _data_type,
+	bool direct_index = true
+>
+class CDenseIdMap
+{
+public:
+	typedef std::pair<_key_type, _data_type*> value_type;
+	typedef xr_vector<value_type> PACKED;
+	typedef typename PACKED::iterator iterator;
+	typedef typename PACKED::const_iterator const_iterator;
+
+	enum
+	{
+		invalid_index = u32(-1)
+	};
+
+private:
+	typedef xr_unordered_map<_key_type, u32> SPARSE_INDEX;
+
+private:
+	PACKED m_packed;
+	xr_vector<u32> m_slots;
+	SPARSE_INDEX m_sparse;
+
+private:
+	IC void set_index(const _key_type& id, u32 index);
+	IC void reset_index(const _key_type& id);
+
+public:
+	IC u32 index(const _key_type& id) const;
+	IC bool insert(const _key_type& id, _data_type* value);
+	IC void erase_at(u32 index);
+	IC bool erase(const _key_type& id);
+	IC void swap_at(u32 index0, u32 index1);
+	IC iterator find(const _key_type& id);
+	IC const_iterator find(const _key_type& id) const;
+	IC value_type& operator[](u32 index);
+	IC const value_type& operator[](u32 index) const;
+	IC iterator begin() { return (m_packed.begin()); }
+	IC iterator end() { return (m_packed.end()); }
+	IC const_iterator begin() const { return (m_packed.begin()); }
+	IC const_iterator end() const { return (m_packed.end()); }
+	IC u32 size() const { return (m_packed.size()); }
+	IC bool empty() const { return (m_packed.empty()); }
+	IC void clear();
+	IC void reserve(u32 count);
+};
+
+#include "dense_id_map_inline.h"
@@ -0,0 +1,148 @@
+////////////////////////////////////////////////////////////////////////////
+//	Module 		: dense_id_map_inline.h
+//	Created 	: 19.10.2026
+//  Modified 	: 19.10.2026
+//	Description : Dense id-indexed map with packed storage inline functions
+////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#define TEMPLATE_SPECIALIZATION \
+	template <\
+		typename _key_type,\
+		typename _data_type,\
+		bool	 direct_index\
+	>
+
+#define CSDenseIdMap	CDenseIdMap<_key_type,_data_type,direct_index>
+
+TEMPLATE_SPECIALIZATION
+IC u32 CSDenseIdMap::index(const _key_type& id) const
+{
+	if (direct_index)
+	{
+		u32 slot = u32(id);
+		return (slot < m_slots.size() ? m_slots[slot] : u32(invalid_index));
+	}
+
+	typename SPARSE_INDEX::const_iterator I = m_sparse.find(id);
+	return (I != m_sparse.end() ? (*I).second : u32(invalid_index));
+}
+
+TEMPLATE_SPECIALIZATION
+IC void CSDenseIdMap::set_index(const _key_type& id, u32 index)
+{
+	if (direct_index)
+	{
+		u32 slot = u32(id);
+		if (slot >= m_slots.size())
+			m_slots.resize(slot + 1, u32(invalid_index));
+		m_slots[slot] = index;
+		return;
+	}
+
+	m_sparse[id] = index;
+}
+
+TEMPLATE_SPECIALIZATION
+IC void CSDenseIdMap::reset_index(const _key_type& id)
+{
+	if (direct_index)
+		m_slots[u32(id)] = u32(invalid_index);
+	else
+		m_sparse.erase(id);
+}
+
+TEMPLATE_SPECIALIZATION
+IC bool CSDenseIdMap::insert(const _key_type& id, _data_type* value)
+{
+	if (index(id) != u32(invalid_index))
+		return (false);
+
+	set_index(id, m_packed.size());
+	m_packed.push_back(std::make_pair(id, value));
+	return (true);
+}
+
+TEMPLATE_SPECIALIZATION
+IC void CSDenseIdMap::erase_at(u32 index)
+{
+	VERIFY(index < m_packed.size());
+	reset_index(m_packed[index].first);
+
+	u32 last = m_packed.size() - 1;
+	if (index != last)
+	{
+		m_packed[index] = m_packed[last];
+		set_index(m_packed[index].first, index);
+	}
+
+	m_packed.pop_back();
+}
+
+TEMPLATE_SPECIALIZATION
+IC bool CSDenseIdMap::erase(const _key_type& id)
+{
+	u32 i = index(id);
+	if (i == u32(invalid_index))
+		return (false);
+
+	erase_at(i);
+	return (true);
+}
+
+TEMPLATE_SPECIALIZATION
+IC void CSDenseIdMap::swap_at(u32 index0, u32 index1)
+{
+	if (index0 == index1)
+		return;
+
+	std::swap(m_packed[index0], m_packed[index1]);
+	set_index(m_packed[index0].first, index0);
+	set_index(m_packed[index1].first, index1);
+}
+
+TEMPLATE_SPECIALIZATION
+IC typename CSDenseIdMap::iterator CSDenseIdMap::find(const _key_type& id)
+{
+	u32 i = index(id);
+	return (i == u32(invalid_index) ? m_packed.end() : m_packed.begin() + i);
+}
+
+TEMPLATE_SPECIALIZATION
+IC typename CSDenseIdMap::const_iterator CSDenseIdMap::find(const _key_type& id) const
+{
+	u32 i = index(id);
+	return (i == u32(invalid_index) ? m_packed.end() : m_packed.begin() + i);
+}
+
+TEMPLATE_SPECIALIZATION
+IC typename CSDenseIdMap::value_type& CSDenseIdMap::operator[](u32 index)
+{
+	VERIFY(index < m_packed.size());
+	return (m_packed[index]);
+}
+
+TEMPLATE_SPECIALIZATION
+IC const typename CSDenseIdMap::value_type& CSDenseIdMap::operator[](u32 index) const
+{
+	VERIFY(index < m_packed.size());
+	return (m_packed[index]);
+}
+
+TEMPLATE_SPECIALIZATION
+IC void CSDenseIdMap::clear()
+{
+	m_packed.clear();
+	m_slots.clear();
+	m_sparse.clear();
+}
+
+TEMPLATE_SPECIALIZATION
+IC void CSDenseIdMap::reserve(u32 count)
+{
+	m_packed.reserve(count);
+}
+
+#undef TEMPLATE_SPECIALIZATION
+#undef CSDenseIdMap
@@ -92,6 +92,11 @@ void CEatableItemObject::UpdateCL()
 	CEatableItem::UpdateCL();
 }
 
+bool CEatableItemObject::UpdateCL_Parallel()
+{
+	return parallel_update_allowed();
+}
+
 void CEatableItemObject::OnEvent(NET_Packet& P, u16 type)
 {
 	CPhysicItem::OnEvent(P, type);
@@ -41,6 +41,7 @@ public:
 	virtual void OnH_B_Chield();
 	virtual void OnH_A_Chield();
 	virtual void UpdateCL();
+	virtual bool UpdateCL_Parallel();
 	virtual void OnEvent(NET_Packet& P, u16 type);
 	virtual BOOL net_Spawn(CSE_Abstract* DC);
 	virtual void net_Destroy();
@@ -32,6 +32,7 @@ public:
 	virtual bool ActivateItem();
 	virtual void DeactivateItem();
 	virtual void UpdateCL();
+	virtual bool UpdateCL_Parallel() { return false; }
 	virtual void renderable_Render();
 	virtual void on_renderable_Render();
 	virtual void OnMoveToRuck(const SInvItemPlace& prev);
@@ -1536,3 +1536,14 @@ bool CInventoryItem::has_network_synchronization() const
 {
 	return false;
 }
+
+bool CInventoryItem::parallel_update_allowed()
+{
+	// an item in someone's inventory has no active shell and no obstacle to move, it only keeps
+	// its own state unless particles are attached or it has to interpolate in multiplayer
+#ifdef DEBUG
+	if (bDebug)
+		return false;
+#endif
+	return object().H_Parent() && !object().IsPlaying() && IsGameTypeSingle();
+}
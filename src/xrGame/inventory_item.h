@@ -236,6 +236,8 @@ public:
 public:
 	virtual void activate_physic_shell();
 	virtual bool has_network_synchronization() const;
+	// UpdateCL_Parallel of the item objects: nothing but the item's own state is touched
+	bool parallel_update_allowed();
 
 	virtual bool NeedToDestroyObject() const;
 	virtual ALife::_TIME_ID TimePassedAfterIndependant() const;
@@ -87,6 +87,11 @@ void CInventoryItemObject::UpdateCL()
 	CInventoryItem::UpdateCL();
 }
 
+bool CInventoryItemObject::UpdateCL_Parallel()
+{
+	return parallel_update_allowed();
+}
+
 void CInventoryItemObject::OnEvent(NET_Packet& P, u16 type)
 {
 	CPhysicItem::OnEvent(P, type);
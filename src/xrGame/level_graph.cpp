@@ -42,6 +42,20 @@ CLevelGraph::CLevelGraph()
 	m_access_mask.assign(header().vertex_count(), true);
 	unpack_xz(vertex_position(header().box().max), m_max_x, m_max_z);
 
+	// vertices are sorted by xz, so every x column is a contiguous run; column() may be asked for
+	// any x up to m_max_x, the columns past the last vertex are empty
+	u32 vertex_count = header().vertex_count();
+	u32 column_count = _max(m_column_length, m_max_x + 1);
+	if (vertex_count)
+		column_count = _max(column_count, m_nodes[vertex_count - 1].position().xz() / m_row_length + 1);
+
+	m_columns.resize(column_count + 1);
+	for (u32 x = 0, id = 0; x <= column_count; ++x)
+	{
+		for (u32 xz = x * m_row_length; id < vertex_count && m_nodes[id].position().xz() < xz; ++id);
+		m_columns[x] = id;
+	}
+
 #ifdef DEBUG
 #	ifndef AI_COMPILER
 		m_current_level_id		= -1;
@@ -59,18 +73,59 @@ CLevelGraph::~CLevelGraph()
 
 u32 CLevelGraph::vertex(const Fvector& position) const
 {
-	CLevelGraph::CPosition _node_position;
-	vertex_position(_node_position, position);
+	// searches square rings of cells around the position, nearest first. Every vertex of ring r is
+	// at least (r - 1) cells away across xz, so once the best one is closer the search is over.
+	// Picks the same vertex as a scan over the whole graph, ties go to the lower id.
+	float cell_size = header().cell_size();
+	int column_count = int(m_columns.size()) - 1;
+	int row_length = int(m_row_length);
+	int px = clampr(iFloor((position.x - header().box().min.x) / cell_size + .5f), 0, column_count - 1);
+	int pz = clampr(iFloor((position.z - header().box().min.z) / cell_size + .5f), 0, row_length - 1);
+
 	float min_dist = flt_max;
 	u32 selected;
 	set_invalid_vertex(selected);
-	for (u32 i = 0; i < header().vertex_count(); ++i)
+
+	auto check = [&](int x, int z0, int z1)
 	{
-		float dist = distance(i, position);
-		if (dist < min_dist)
+		const CVertex *I, *E;
+		column(u32(x), u32(z0), u32(z1), I, E);
+		for (; I != E; ++I)
+		{
+			u32 id = u32(I - m_nodes);
+			float dist = distance(position, I);
+			if (dist < min_dist || (dist == min_dist && id < selected))
+			{
+				min_dist = dist;
+				selected = id;
+			}
+		}
+	};
+
+	for (int r = 0;; ++r)
+	{
+		// distances are squared
+		float ring_dist = float(_max(r - 1, 0)) * cell_size;
+		if (ring_dist * ring_dist > min_dist)
+			break;
+
+		int x0 = px - r, x1 = px + r;
+		int z0 = pz - r, z1 = pz + r;
+		if (x0 < 0 && z0 < 0 && x1 >= column_count && z1 >= row_length)
+			break;
+
+		for (int x = _max(x0, 0), x_end = _min(x1, column_count - 1); x <= x_end; ++x)
 		{
-			min_dist = dist;
-			selected = i;
+			if (x == x0 || x == x1)
+			{
+				check(x, _max(z0, 0), _min(z1, row_length - 1));
+				continue;
+			}
+
+			if (z0 >= 0)
+				check(x, z0, z0);
+			if (z1 < row_length)
+				check(x, z1, z1);
 		}
 	}
 
@@ -241,21 +296,19 @@ u32 CLevelGraph::vertex_id(const Fvector& position) const
 		return (u32(-1));
 	}
 
-	CPosition _vertex_position = vertex_position(position);
-	CVertex* B = m_nodes;
-	CVertex* E = m_nodes + header().vertex_count();
-	CVertex* I = std::lower_bound(B, E, _vertex_position.xz());
-	if ((I == E) || ((*I).position().xz() != _vertex_position.xz()))
+	u32 x, z;
+	unpack_xz(vertex_position(position), x, z);
+
+	const CVertex *I, *E;
+	column(x, z, z, I, E);
+	if (I == E)
 		return (u32(-1));
 
-	u32 best_vertex_id = u32(I - B);
+	u32 best_vertex_id = u32(I - m_nodes);
 	float y = vertex_plane_y(best_vertex_id, position.x, position.z);
 	for (++I; I != E; ++I)
 	{
-		if ((*I).position().xz() != _vertex_position.xz())
-			break;
-
-		u32 new_vertex_id = u32(I - B);
+		u32 new_vertex_id = u32(I - m_nodes);
 		float _y = vertex_plane_y(new_vertex_id, position.x, position.z);
 		if (y <= position.y)
 		{
@@ -313,8 +366,6 @@ u32 CLevelGraph::guess_vertex_id(u32 const& current_vertex_id, Fvector const& po
 	float result_distance = nearest(best_point, position, vertex_contour);
 	u32 result_vertex_id = current_vertex_id;
 
-	CVertex const* B = m_nodes;
-	CVertex const* E = m_nodes + header().vertex_count();
 	u32 start_x = (u32)_max(0, int(x) - max_guess_vertex_count);
 	u32 stop_x = _min(max_x(), x + (u32)max_guess_vertex_count);
 	u32 start_z = (u32)_max(0, int(z) - max_guess_vertex_count);
@@ -323,23 +374,17 @@ u32 CLevelGraph::guess_vertex_id(u32 const& current_vertex_id, Fvector const& po
 	{
 		for (u32 j = start_z; j <= stop_z; ++j)
 		{
-			u32 test_xz = i * m_row_length + j;
-			CVertex const* I = std::lower_bound(B, E, test_xz);
+			CVertex const *I, *E;
+			column(i, j, j, I, E);
 			if (I == E)
 				continue;
 
-			if ((*I).position().xz() != test_xz)
-				continue;
-
-			u32 best_vertex_id = u32(I - B);
+			u32 best_vertex_id = u32(I - m_nodes);
 			contour(vertex_contour, best_vertex_id);
 			float best_distance = nearest(best_point, position, vertex_contour);
 			for (++I; I != E; ++I)
 			{
-				if ((*I).position().xz() != test_xz)
-					break;
-
-				u32 vertex_id = u32(I - B);
+				u32 vertex_id = u32(I - m_nodes);
 				Fvector point;
 				contour(vertex_contour, vertex_id);
 				float distance = nearest(point, position, vertex_contour);
@@ -17,6 +17,7 @@
 #include "alife_space.h"
 #include "level_graph_space.h"
 #include "game_graph_space.h"
+#include <xmmintrin.h>
 
 #include "../Include/xrRender/DebugShader.h"
 
@@ -61,8 +62,10 @@ private:
 	u32 m_column_length;
 	u32 m_max_x;
 	u32 m_max_z;
+	xr_vector<u32> m_columns; // index of the first vertex in every x column, vertices are sorted by xz
 
 private:
+	IC void column(u32 x, u32 z0, u32 z1, const CVertex*& begin, const CVertex*& end) const;
 	u32 vertex(const Fvector& position) const;
 	u32 guess_vertex_id(u32 const& current_vertex_id, Fvector const& position) const;
 
@@ -109,6 +112,7 @@ public:
 	IC void clear_mask_no_check(u32 vertex_id);
 
 	IC bool is_accessible(const u32 vertex_id) const;
+	IC void prefetch(const u32 vertex_id) const;
 	IC void level_id(const GameGraph::_LEVEL_ID& level_id);
 	IC u32 max_x() const;
 	IC u32 max_z() const;
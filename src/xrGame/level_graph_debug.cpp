@@ -616,8 +616,8 @@ void CLevelGraph::draw_game_graph	()
 			}
 		}
 
-		ALife::D_OBJECT_P_MAP::const_iterator	I = ai().alife().objects().objects().begin();
-		ALife::D_OBJECT_P_MAP::const_iterator	E = ai().alife().objects().objects().end();
+		CALifeObjectRegistry::OBJECT_REGISTRY::const_iterator	I = ai().alife().objects().objects().begin();
+		CALifeObjectRegistry::OBJECT_REGISTRY::const_iterator	E = ai().alife().objects().objects().end();
 		for ( ; I != E; ++I) {
 			{
 				CSE_ALifeMonsterAbstract *tpALifeMonsterAbstract = smart_cast<CSE_ALifeMonsterAbstract *>((*I).second);
@@ -371,6 +371,13 @@ IC bool CLevelGraph::is_accessible(const u32 vertex_id) const
 	return (valid_vertex_id(vertex_id) && m_access_mask[vertex_id]);
 }
 
+IC void CLevelGraph::prefetch(const u32 vertex_id) const
+{
+	VERIFY(valid_vertex_id(vertex_id));
+	_mm_prefetch((const char*)(m_nodes + vertex_id), _MM_HINT_T0);
+	_mm_prefetch((const char*)(m_nodes + vertex_id + 1) - 1, _MM_HINT_T0);
+}
+
 IC void CLevelGraph::set_invalid_vertex(u32& vertex_id, CVertex** vertex) const
 {
 	vertex_id = u32(-1);
@@ -727,3 +734,12 @@ IC bool operator==(const u32& vertex_xz, const CLevelGraph::CVertex& vertex)
 {
 	return (vertex_xz == vertex.position().xz());
 }
+
+IC void CLevelGraph::column(u32 x, u32 z0, u32 z1, const CVertex*& begin, const CVertex*& end) const
+{
+	VERIFY(x <= m_max_x && z0 <= z1);
+	const CVertex* B = m_nodes + m_columns[x];
+	const CVertex* E = m_nodes + m_columns[x + 1];
+	begin = std::lower_bound(B, E, x * m_row_length + z0, &vertex::predicate2);
+	end = std::upper_bound(begin, E, x * m_row_length + z1, &vertex::predicate);
+}
@@ -21,6 +21,9 @@ moving_object::moving_object(const CEntityAlive* object)
 	m_action_frame = 0;
 	m_action_time = 0;
 
+	m_crowd_index = u32(-1);
+	m_crowd_query_time = 0;
+
 	update_position();
 
 	ai().moving_objects().register_object(this);
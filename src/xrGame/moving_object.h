@@ -39,6 +39,10 @@ private:
 	u32 m_action_frame;
 	u32 m_action_time;
 
+private:
+	u32 m_crowd_index;
+	u32 m_crowd_query_time;
+
 public:
 	moving_object(const CEntityAlive* object);
 	~moving_object();
@@ -60,6 +64,10 @@ public:
 	IC const u32& action_time() const;
 	IC obstacles_query& static_query();
 	IC obstacles_query& dynamic_query();
+	IC const u32& crowd_index() const;
+	IC void crowd_index(const u32& index);
+	IC const u32& crowd_query_time() const;
+	IC void on_crowd_query();
 };
 
 #include "moving_object_inline.h"
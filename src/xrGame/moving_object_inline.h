@@ -91,4 +91,24 @@ IC obstacles_query& moving_object::dynamic_query()
 	return (m_dynamic_query);
 }
 
+IC const u32& moving_object::crowd_index() const
+{
+	return (m_crowd_index);
+}
+
+IC void moving_object::crowd_index(const u32& index)
+{
+	m_crowd_index = index;
+}
+
+IC const u32& moving_object::crowd_query_time() const
+{
+	return (m_crowd_query_time);
+}
+
+IC void moving_object::on_crowd_query()
+{
+	m_crowd_query_time = Device.dwTimeGlobal;
+}
+
 #endif // MOVING_OBJECT_INLINE_H
@@ -13,7 +13,8 @@
 #include "moving_object.h"
 
 moving_objects::moving_objects() :
-	m_tree(0)
+	m_tree(0),
+	m_crowd_frame(u32(-1))
 {
 }
 
@@ -25,6 +26,8 @@ moving_objects::~moving_objects()
 void moving_objects::on_level_load()
 {
 	xr_delete(m_tree);
+	m_crowd.clear();
+	m_crowd_frame = u32(-1);
 	m_tree = xr_new<TREE>(ai().level_graph().header().box(), ai().level_graph().header().cell_size() * .5f, 16 * 1024,
 	                      16 * 1024);
 }
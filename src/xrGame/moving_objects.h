@@ -58,6 +58,25 @@ private:
 	COLLISIONS m_previous_collisions;
 	Spatials m_spatial_objects;
 
+private:
+	struct crowd_agent
+	{
+		moving_object* object;
+		Fvector2 position;
+		Fvector2 velocity;
+		float radius;
+		float speed_factor;
+		bool participant;
+		bool resolved;
+	};
+
+	typedef xr_vector<crowd_agent> CROWD;
+
+private:
+	CROWD m_crowd;
+	NEAREST_MOVING m_crowd_objects;
+	u32 m_crowd_frame;
+
 #ifdef DEBUG
 private:
 	typedef xr_set<moving_object*>						OBJECTS;
@@ -99,6 +118,11 @@ private:
 	void generate_emitters();
 	void resolve_collisions();
 
+private:
+	void describe_crowd_agent(moving_object* object, crowd_agent& agent) const;
+	void resolve_crowd_agent(crowd_agent& agent, NEAREST_MOVING& nearest) const;
+	void update_crowd();
+
 public:
 	moving_objects();
 	~moving_objects();
@@ -116,6 +140,7 @@ public:
 	void query_action_static(moving_object* object, const Fvector& start_position, const Fvector& dest_position);
 	void query_action_static(moving_object* object);
 	IC const COLLISIONS& collisions() const;
+	bool crowd_speed_factor(moving_object* object, float& speed_factor);
 	void clear();
 };
 
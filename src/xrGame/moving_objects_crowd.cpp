@@ -0,0 +1,228 @@
+////////////////////////////////////////////////////////////////////////////
+//	Module 		: moving_objects_crowd.cpp
+//	Created 	: 19.10.2026
+//  Modified 	: 19.10.2026
+//	Description : moving objects crowd avoidance, reciprocal velocity obstacles
+////////////////////////////////////////////////////////////////////////////
+
+#include "stdafx.h"
+#include "moving_objects.h"
+#include "moving_object.h"
+#include "../xrcore/xr_parallel.h"
+
+// Once per frame every moving object gets an ORCA (optimal reciprocal collision avoidance) set of
+// half-plane constraints on its velocity, one per neighbour. Stalkers are bound to their detail
+// path, so the velocity may only be scaled along it: the constraints are intersected with the
+// segment [0, preferred velocity] and the fastest point left is the speed factor. When nothing is
+// left the object is not resolved here and goes through the collision prediction and path
+// rebuilding of query_action_dynamic as before.
+
+BOOL g_ai_crowd_avoidance = TRUE;
+
+static const float crowd_prediction_time = .5f;
+static const float crowd_time_horizon = 1.5f;
+static const float crowd_time_step = .25f;
+static const float crowd_neighbour_radius = 6.f;
+static const float crowd_height = 2.f;
+static const float crowd_radius_factor = .5f;
+static const u32 crowd_participant_time = 500;
+static const u32 crowd_agents_per_task = 16;
+
+IC static float det(const Fvector2& a, const Fvector2& b)
+{
+	return (a.x * b.y - a.y * b.x);
+}
+
+void moving_objects::describe_crowd_agent(moving_object* object, crowd_agent& agent) const
+{
+	const Fvector& position = object->position();
+	Fvector next_position = object->predict_position(crowd_prediction_time);
+
+	agent.object = object;
+	agent.position.set(position.x, position.z);
+	agent.velocity.set(next_position.x - position.x, next_position.z - position.z).div(crowd_prediction_time);
+	agent.radius = object->radius() * crowd_radius_factor;
+	agent.speed_factor = 1.f;
+	agent.participant =
+		object->crowd_query_time() &&
+		(Device.dwTimeGlobal < object->crowd_query_time() + crowd_participant_time);
+	agent.resolved = false;
+}
+
+// the velocities of agent allowed by other lie to the left of the returned line, agent takes the
+// given share of the avoidance; false when the two stand on each other and nothing can be told
+static bool crowd_line(const Fvector2& position0, const Fvector2& velocity0, const float& radius0,
+                       const Fvector2& position1, const Fvector2& velocity1, const float& radius1,
+                       float responsibility, Fvector2& direction, Fvector2& point)
+{
+	Fvector2 relative_position = Fvector2().sub(position1, position0);
+	Fvector2 relative_velocity = Fvector2().sub(velocity0, velocity1);
+	float distance_sqr = relative_position.square_magnitude();
+	float radius = radius0 + radius1;
+	float radius_sqr = _sqr(radius);
+
+	Fvector2 u;
+	if (distance_sqr > radius_sqr)
+	{
+		Fvector2 w = Fvector2().mad(relative_velocity, relative_position, -1.f / crowd_time_horizon);
+		float w_length_sqr = w.square_magnitude();
+		float w_dot = w.dot(relative_position);
+
+		if ((w_dot < 0.f) && (_sqr(w_dot) > radius_sqr * w_length_sqr))
+		{
+			// closest to the cut-off circle of the truncated cone
+			float w_length = _sqrt(w_length_sqr);
+			Fvector2 unit_w = Fvector2().set(w).div(w_length);
+			direction.set(unit_w.y, -unit_w.x);
+			u.set(unit_w).mul(radius / crowd_time_horizon - w_length);
+		}
+		else
+		{
+			// closest to one of the legs
+			float leg = _sqrt(distance_sqr - radius_sqr);
+			if (det(relative_position, w) > 0.f)
+				direction.set(
+					relative_position.x * leg - relative_position.y * radius,
+					relative_position.x * radius + relative_position.y * leg
+				).div(distance_sqr);
+			else
+				direction.set(
+					-(relative_position.x * leg + relative_position.y * radius),
+					-(-relative_position.x * radius + relative_position.y * leg)
+				).div(distance_sqr);
+
+			u.set(direction).mul(relative_velocity.dot(direction)).sub(relative_velocity);
+		}
+	}
+	else
+	{
+		// already overlapping, get apart within one step
+		Fvector2 w = Fvector2().mad(relative_velocity, relative_position, -1.f / crowd_time_step);
+		float w_length = w.magnitude();
+		if (fis_zero(w_length))
+			return (false);
+
+		Fvector2 unit_w = Fvector2().set(w).div(w_length);
+		direction.set(unit_w.y, -unit_w.x);
+		u.set(unit_w).mul(radius / crowd_time_step - w_length);
+	}
+
+	point.mad(velocity0, u, responsibility);
+	return (true);
+}
+
+void moving_objects::resolve_crowd_agent(crowd_agent& agent, NEAREST_MOVING& nearest) const
+{
+	if (!agent.participant)
+		return;
+
+	if (fis_zero(agent.velocity.square_magnitude()))
+		return;
+
+	moving_object* object = agent.object;
+	const Fvector& position = object->position();
+	m_tree->nearest(position, crowd_neighbour_radius, nearest);
+
+	// velocity = preferred * factor, each neighbour bounds the factor from one side
+	float low = 0.f;
+	float high = 1.f;
+
+	NEAREST_MOVING::const_iterator I = nearest.begin();
+	NEAREST_MOVING::const_iterator E = nearest.end();
+	for (; I != E; ++I)
+	{
+		if (*I == object)
+			continue;
+
+		if (_abs((*I)->position().y - position.y) > crowd_height)
+			continue;
+
+		if (!(*I)->object().g_Alive())
+			continue;
+
+		if (object->ignored(&(*I)->object()))
+			continue;
+
+		VERIFY((*I)->crowd_index() < m_crowd.size());
+		const crowd_agent& other = m_crowd[(*I)->crowd_index()];
+
+		Fvector2 direction, point;
+		if (!crowd_line(agent.position, agent.velocity, agent.radius, other.position, other.velocity, other.radius,
+		                other.participant ? .5f : 1.f, direction, point))
+			return;
+
+		float denominator = det(direction, agent.velocity);
+		float numerator = det(direction, point);
+		if (denominator > EPS_L)
+			low = _max(low, numerator / denominator);
+		else if (denominator < -EPS_L)
+			high = _min(high, numerator / denominator);
+		else if (numerator > 0.f)
+			return;
+
+		if (low > high)
+			return;
+	}
+
+	agent.speed_factor = high;
+	agent.resolved = true;
+}
+
+void moving_objects::update_crowd()
+{
+	TRACE_ZONE("crowd_avoidance");
+
+	m_crowd_frame = Device.dwFrame;
+
+	VERIFY(m_tree);
+	m_tree->all(m_crowd_objects);
+
+	u32 count = m_crowd_objects.size();
+	m_crowd.resize(count);
+
+	// neighbours are read while resolving, so all the agents are described first
+	xr_parallel_for(0, count, crowd_agents_per_task, [this](u32 i)
+	{
+		m_crowd_objects[i]->crowd_index(i);
+		describe_crowd_agent(m_crowd_objects[i], m_crowd[i]);
+	});
+
+	xr_parallel_for(0, (count + crowd_agents_per_task - 1) / crowd_agents_per_task, [this, count](u32 task)
+	{
+		NEAREST_MOVING nearest;
+		for (u32 i = task * crowd_agents_per_task, n = _min(i + crowd_agents_per_task, count); i < n; ++i)
+			resolve_crowd_agent(m_crowd[i], nearest);
+	});
+
+	// resolved objects are taken as decided for this frame, query_action_dynamic then neither
+	// processes them nor counts them as emitters for the others
+	CROWD::iterator I = m_crowd.begin();
+	CROWD::iterator E = m_crowd.end();
+	for (; I != E; ++I)
+	{
+		if ((*I).resolved)
+			(*I).object->action(moving_object::action_move);
+	}
+}
+
+bool moving_objects::crowd_speed_factor(moving_object* object, float& speed_factor)
+{
+	if (!g_ai_crowd_avoidance)
+		return (false);
+
+	object->on_crowd_query();
+
+	if (m_crowd_frame != Device.dwFrame)
+		update_crowd();
+
+	u32 index = object->crowd_index();
+	if ((index >= m_crowd.size()) || (m_crowd[index].object != object))
+		return (false);
+
+	const crowd_agent& agent = m_crowd[index];
+	if (!agent.resolved)
+		return (false);
+
+	speed_factor = agent.speed_factor;
+	return (true);
+}
@@ -28,6 +28,8 @@ protected:
 	CSConditionState m_conditions;
 	CSConditionState m_effects;
 	bool* m_actuality;
+	// of the solver the operator belongs to, moves whenever its conditions, effects or weight change
+	u32* m_operators_version;
 	mutable bool m_weight_actual;
 	mutable _edge_value_type m_min_weight;
 
@@ -39,7 +41,7 @@ public:
 	IC COperatorAbstract(const CSConditionState& conditions, const CSConditionState& effects);
 	virtual ~COperatorAbstract();
 	virtual void Load(LPCSTR section);
-	virtual void setup(bool* actuality);
+	virtual void setup(bool* actuality, u32* operators_version);
 	IC const CSConditionState& conditions() const;
 	IC const CSConditionState& effects() const;
 	IC void add_condition(const COperatorCondition& condition);
@@ -19,6 +19,7 @@ TEMPLATE_SPECIALIZATION
 IC CAbstractOperator::COperatorAbstract()
 {
 	m_actuality = 0;
+	m_operators_version = 0;
 	m_weight_actual = true;
 	m_min_weight = 0;
 }
@@ -29,6 +30,7 @@ IC CAbstractOperator::COperatorAbstract(const CSConditionState& conditions, cons
 	m_conditions = conditions;
 	m_effects = effects;
 	m_actuality = 0;
+	m_operators_version = 0;
 	m_weight_actual = false;
 	m_min_weight = 0;
 }
@@ -44,10 +46,12 @@ void CAbstractOperator::Load(LPCSTR section)
 }
 
 TEMPLATE_SPECIALIZATION
-void CAbstractOperator::setup(bool* actuality)
+void CAbstractOperator::setup(bool* actuality, u32* operators_version)
 {
 	VERIFY(actuality);
+	VERIFY(operators_version);
 	m_actuality = actuality;
+	m_operators_version = operators_version;
 	*m_actuality = false;
 }
 
@@ -55,6 +59,9 @@ TEMPLATE_SPECIALIZATION
 IC void CAbstractOperator::actual(bool value)
 {
 	if (!this) return;
+	if (!value && m_operators_version)
+		++*m_operators_version;
+
 	if (!m_actuality)
 		return;
 
@@ -130,6 +130,20 @@ TEMPLATE_SPECIALIZATION
 IC void CLevelPathManager::begin(const _index_type& vertex_id, const_iterator& begin, const_iterator& end)
 {
 	graph->begin(best_node, begin, end);
+
+	// vertex ids follow the xz build order, so the neighbours across x are a whole column away
+	// both in the graph and in the search storage. Asking for all of them at once overlaps the
+	// misses the loop over them would otherwise take one by one, and the next best vertex is
+	// usually one of them.
+	for (const_iterator i = begin; i != end; ++i)
+	{
+		_index_type neighbour = graph->value(best_node, i);
+		if (!graph->valid_vertex_id(neighbour))
+			continue;
+
+		data_storage->prefetch(neighbour);
+		graph->prefetch(neighbour);
+	}
 }
 
 TEMPLATE_SPECIALIZATION
@@ -78,6 +78,25 @@ public:
 	typedef typename OPERATOR_VECTOR::const_iterator const_iterator;
 	typedef associative_vector<_condition_type, _condition_evaluator_ptr> EVALUATORS;
 
+	// solution remembered for a target together with every condition the search looked at, it
+	// stands for as long as those conditions keep their values and no operator changed
+	struct SCachedSolution
+	{
+		CState m_target_state;
+		CState m_current_state;
+		xr_vector<_edge_type> m_solution;
+		u32 m_operators_version;
+		u32 m_last_used;
+		bool m_failed;
+	};
+
+	typedef xr_vector<SCachedSolution> SOLUTIONS;
+
+	enum
+	{
+		solution_cache_size = 8,
+	};
+
 protected:
 	OPERATOR_VECTOR m_operators;
 	EVALUATORS m_evaluators;
@@ -85,8 +104,12 @@ protected:
 	CState m_target_state;
 	mutable CState m_current_state;
 	mutable CState m_temp;
+	mutable CState m_evaluated;
+	SOLUTIONS m_solutions;
+	u32 m_solve_count;
 	mutable bool m_applied;
 	bool m_actuality;
+	u32 m_operators_version;
 	bool m_solution_changed;
 	bool m_failed;
 
@@ -106,6 +129,11 @@ private:
 	IC _edge_value_type estimate_edge_weight_impl(const _index_type& vertex_index) const;
 	IC _edge_value_type estimate_edge_weight_impl(const _index_type& vertex_index, bool) const;
 
+	IC _value_type evaluated_value(const _condition_type& condition_id) const;
+	IC bool valid(const CState& state) const;
+	IC bool cached_solution();
+	IC void cache_solution();
+
 private:
 	template <bool>
 	struct helper
@@ -56,6 +56,8 @@ IC void CProblemSolverAbstract::clear()
 TEMPLATE_SPECIALIZATION
 void CProblemSolverAbstract::init()
 {
+	m_solve_count = 0;
+	m_operators_version = 0;
 }
 
 TEMPLATE_SPECIALIZATION
@@ -64,6 +66,8 @@ void CProblemSolverAbstract::setup()
 	m_target_state.clear();
 	m_current_state.clear();
 	m_temp.clear();
+	m_evaluated.clear();
+	m_solutions.clear();
 	m_solution.clear();
 	m_applied = false;
 	m_solution_changed = false;
@@ -103,6 +107,9 @@ IC void CProblemSolverAbstract::add_operator(const _edge_type& operator_id, _ope
 	validate_properties			(_operator->effects());
 #endif
 	m_actuality = false;
+	if (_operator)
+		_operator->setup(&m_actuality, &m_operators_version);
+	m_solutions.clear();
 	m_operators.insert(I, SOperator(operator_id, _operator));
 }
 
@@ -135,6 +142,7 @@ IC void CProblemSolverAbstract::remove_operator(const _edge_type& operator_id)
 		(*I).m_operator = 0;
 	}
 	m_actuality = false;
+	m_solutions.clear();
 	m_operators.erase(I);
 }
 
@@ -186,6 +194,7 @@ IC void CProblemSolverAbstract::remove_evaluator(const _condition_type& conditio
 	}
 	m_evaluators.erase(I);
 	m_actuality = false;
+	m_solutions.clear();
 }
 
 TEMPLATE_SPECIALIZATION
@@ -209,7 +218,7 @@ IC void CProblemSolverAbstract::evaluate_condition(typename xr_vector<COperatorC
                                                    const _condition_type& condition_id) const
 {
 	size_t index = I - m_current_state.conditions().begin();
-	m_current_state.add_condition(I, COperatorCondition(condition_id, evaluator(condition_id)->evaluate()));
+	m_current_state.add_condition(I, COperatorCondition(condition_id, evaluated_value(condition_id)));
 	I = m_current_state.conditions().begin() + index;
 	E = m_current_state.conditions().end();
 }
@@ -374,17 +383,106 @@ IC typename CProblemSolverAbstract::_operator_ptr CProblemSolverAbstract::get_op
 	return ((*I).get_operator());
 }
 
+// evaluators are asked once per solve, the values are shared by the solutions checked and the search
+TEMPLATE_SPECIALIZATION
+IC typename CProblemSolverAbstract::_value_type CProblemSolverAbstract::evaluated_value(
+	const _condition_type& condition_id) const
+{
+	const COperatorCondition* known = m_evaluated.property(condition_id);
+	if (known && (known->condition() == condition_id))
+		return (known->value());
+
+	_value_type value = evaluator(condition_id)->evaluate();
+	m_evaluated.add_condition(COperatorCondition(condition_id, value));
+	return (value);
+}
+
+TEMPLATE_SPECIALIZATION
+IC bool CProblemSolverAbstract::valid(const CState& state) const
+{
+	xr_vector<COperatorCondition>::const_iterator I = state.conditions().begin();
+	xr_vector<COperatorCondition>::const_iterator E = state.conditions().end();
+	for (; I != E; ++I)
+		if (evaluated_value((*I).condition()) != (*I).value())
+			return (false);
+	return (true);
+}
+
+// the search reads the world through evaluators only, so given the same operators, the same target
+// and the same values of every condition it evaluated it comes to the same solution
+TEMPLATE_SPECIALIZATION
+IC bool CProblemSolverAbstract::cached_solution()
+{
+	SOLUTIONS::iterator I = m_solutions.begin();
+	SOLUTIONS::iterator E = m_solutions.end();
+	for (; I != E; ++I)
+	{
+		if ((*I).m_operators_version != m_operators_version)
+			continue;
+
+		if (!((*I).m_target_state == target_state()))
+			continue;
+
+		if (!valid((*I).m_current_state))
+			continue;
+
+		(*I).m_last_used = ++m_solve_count;
+		m_current_state = (*I).m_current_state;
+		m_solution = (*I).m_solution;
+		m_failed = (*I).m_failed;
+		return (true);
+	}
+	return (false);
+}
+
+TEMPLATE_SPECIALIZATION
+IC void CProblemSolverAbstract::cache_solution()
+{
+	SOLUTIONS::iterator I = m_solutions.end();
+	if (m_solutions.size() < solution_cache_size)
+		I = m_solutions.insert(m_solutions.end(), SCachedSolution());
+	else
+	{
+		I = m_solutions.begin();
+		SOLUTIONS::iterator J = m_solutions.begin();
+		SOLUTIONS::iterator E = m_solutions.end();
+		for (; J != E; ++J)
+		{
+			if ((*J).m_operators_version != m_operators_version)
+			{
+				I = J;
+				break;
+			}
+
+			if ((*J).m_last_used < (*I).m_last_used)
+				I = J;
+		}
+	}
+
+	(*I).m_target_state = target_state();
+	(*I).m_current_state = current_state();
+	(*I).m_solution = m_solution;
+	(*I).m_operators_version = m_operators_version;
+	(*I).m_last_used = ++m_solve_count;
+	(*I).m_failed = m_failed;
+}
+
 TEMPLATE_SPECIALIZATION
 IC void CProblemSolverAbstract::solve()
 {
 #ifndef AI_COMPILER
 	m_solution_changed = false;
+	m_evaluated.clear();
 
-	if (actual())
+	if (m_actuality && valid(current_state()))
 		return;
 
 	m_actuality = true;
 	m_solution_changed = true;
+
+	if (cached_solution())
+		return;
+
 	m_current_state.clear();
 
 	m_failed = !
@@ -399,6 +497,8 @@ IC void CProblemSolverAbstract::solve()
 				8000
 			)
 		);
+
+	cache_solution();
 #endif
 }
 
@@ -82,12 +82,12 @@ extern Flags32 psAI_Flags;
 
 IC	CProfiler&	profiler();
 		
-#	define START_PROFILE(a) { CProfilePortion	__profile_portion__(a);
+#	define START_PROFILE(a) { CProfilePortion	__profile_portion__(a); TRACE_ZONE(a);
 #	define STOP_PROFILE     }
 
 #	include "profiler_inline.h"
 
 #else // DEBUG
-#	define START_PROFILE(a) {
+#	define START_PROFILE(a) { TRACE_ZONE(a);
 #	define STOP_PROFILE		}
 #endif // DEBUG
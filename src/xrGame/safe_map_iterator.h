@@ -8,32 +8,39 @@
 
 #pragma once
 
+#include "dense_id_map.h"
+
+// Time-sliced round-robin update over a registry. Objects before m_next have already been
+// visited in the current pass, remove() keeps that split intact, so an update resumes with the
+// next pending object no matter what was added or removed in between.
 template <
 	typename _key_type,
 	typename _data_type,
 	typename _predicate = std::less<_key_type>,
 	bool use_time_limit = true,
 	typename _cycle_type = u64,
-	bool use_first_update = true
+	bool use_first_update = true,
+	bool direct_index = true
 >
 class CSafeMapIterator
 {
 public:
-	typedef xr_map<_key_type, _data_type*, _predicate> _REGISTRY;
-	typedef typename _REGISTRY::iterator _iterator;
+	typedef CDenseIdMap<_key_type, _data_type, direct_index> _REGISTRY;
+	typedef typename _REGISTRY::value_type _value_type;
+	// predicates get a pointer to a copy of the current pair, they may add or remove objects
+	typedef _value_type* _iterator;
 	typedef typename _REGISTRY::const_iterator _const_iterator;
 
 protected:
 	_REGISTRY m_objects;
 	_cycle_type m_cycle_count;
-	_iterator m_next_iterator;
+	u32 m_next;
 	CTimer m_timer;
 	float m_max_process_time;
 	bool m_first_update;
 
 protected:
 	IC void update_next();
-	IC _iterator& next();
 	IC void start_timer();
 	IC bool time_over();
 
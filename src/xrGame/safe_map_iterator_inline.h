@@ -15,10 +15,11 @@
 		typename _predicate,\
 		bool	 use_time_limit,\
 		typename _cycle_type,\
-		bool	 use_first_update\
+		bool	 use_first_update,\
+		bool	 direct_index\
 	>
 
-#define CSSafeMapIterator	CSafeMapIterator<_key_type,_data_type,_predicate,use_time_limit,_cycle_type,use_first_update>
+#define CSSafeMapIterator	CSafeMapIterator<_key_type,_data_type,_predicate,use_time_limit,_cycle_type,use_first_update,direct_index>
 
 TEMPLATE_SPEZIALIZATION
 IC CSSafeMapIterator::CSafeMapIterator()
@@ -26,7 +27,7 @@ IC CSSafeMapIterator::CSafeMapIterator()
 	m_cycle_count = 0;
 	m_first_update = use_first_update;
 	m_max_process_time = 0.f;
-	update_next();
+	m_next = 0;
 }
 
 TEMPLATE_SPEZIALIZATION
@@ -37,28 +38,20 @@ CSSafeMapIterator::~CSafeMapIterator()
 TEMPLATE_SPEZIALIZATION
 IC void CSSafeMapIterator::add(const _key_type& id, _data_type* value, bool no_assert)
 {
-	_const_iterator I = m_objects.find(id);
-	if (I != m_objects.end())
+	if (!m_objects.insert(id, value))
 	{
 #ifdef DEBUG
 		THROW2(no_assert, "Specified object has been already found in the registry!");
 #endif
 		return;
 	}
-
-	bool addition = m_objects.empty();
-
-	m_objects.insert(std::make_pair(id, value));
-
-	if (addition)
-		m_next_iterator = m_objects.begin();
 }
 
 TEMPLATE_SPEZIALIZATION
 IC void CSSafeMapIterator::remove(const _key_type& id, bool no_assert)
 {
-	_iterator I = m_objects.find(id);
-	if (I == m_objects.end())
+	u32 index = m_objects.index(id);
+	if (index == u32(_REGISTRY::invalid_index))
 	{
 #ifdef DEBUG
 		THROW2(no_assert, "Specified object hasn't been found in the registry!");
@@ -66,32 +59,26 @@ IC void CSSafeMapIterator::remove(const _key_type& id, bool no_assert)
 		return;
 	}
 
-	if (I == m_next_iterator)
-		update_next();
+	// move a visited object out of the visited part first, so erase_at only reorders pending ones
+	if (index < m_next)
+	{
+		--m_next;
+		m_objects.swap_at(index, m_next);
+		index = m_next;
+	}
 
-	m_objects.erase(I);
+	m_objects.erase_at(index);
 
-	if (m_objects.empty())
-		update_next();
+	if (m_next >= m_objects.size())
+		m_next = 0;
 }
 
 TEMPLATE_SPEZIALIZATION
 IC void CSSafeMapIterator::update_next()
 {
-	if (m_objects.empty())
-		m_next_iterator = m_objects.begin();
-	else
-	{
-		++m_next_iterator;
-		if (m_next_iterator == m_objects.end())
-			m_next_iterator = m_objects.begin();
-	}
-}
-
-TEMPLATE_SPEZIALIZATION
-IC typename CSSafeMapIterator::_iterator&CSSafeMapIterator::next()
-{
-	return (m_next_iterator);
+	++m_next;
+	if (m_next >= m_objects.size())
+		m_next = 0;
 }
 
 TEMPLATE_SPEZIALIZATION
@@ -127,14 +114,18 @@ IC u32 CSSafeMapIterator::update(const _update_predicate& predicate, bool const
 
 	start_timer();
 	++m_cycle_count;
-	_iterator I = next();
-	VERIFY(I != m_objects.end());
 	u32 i = 0;
-	for (; (I != m_objects.end()) && !time_over() && predicate(I, m_cycle_count, true); ++i)
+	while (!m_objects.empty() && !time_over())
 	{
+		VERIFY(m_next < m_objects.size());
+		_value_type current = m_objects[m_next];
+		_iterator I = &current;
+		if (!predicate(I, m_cycle_count, true))
+			break;
+
 		update_next();
 		predicate(I, m_cycle_count);
-		I = next();
+		++i;
 	}
 	m_first_update = iterate_as_first_time_next_time;
 	return (i);
@@ -156,7 +147,7 @@ IC bool CSSafeMapIterator::empty() const
 TEMPLATE_SPEZIALIZATION
 IC void CSSafeMapIterator::begin()
 {
-	m_next_iterator = m_objects.begin();
+	m_next = 0;
 	m_first_update = true;
 }
 
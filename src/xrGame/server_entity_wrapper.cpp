@@ -9,6 +9,7 @@
 #include "stdafx.h"
 #include "server_entity_wrapper.h"
 #include "xrServer_Objects.h"
+#include "xrServer_Objects_ALife.h"
 #include "xrmessages.h"
 
 #ifdef AI_COMPILER
@@ -19,7 +20,8 @@ struct ISE_Abstract;
 
 CServerEntityWrapper::~CServerEntityWrapper()
 {
-	F_entity_Destroy(m_object);
+	if (m_object)
+		F_entity_Destroy(m_object);
 }
 
 void CServerEntityWrapper::save(IWriter& stream)
@@ -29,7 +31,7 @@ void CServerEntityWrapper::save(IWriter& stream)
 	// Spawn
 	stream.open_chunk(0);
 
-	m_object->Spawn_Write(net_packet,TRUE);
+	object().Spawn_Write(net_packet,TRUE);
 	stream.w_u16(u16(net_packet.B.count));
 	stream.w(net_packet.B.data, net_packet.B.count);
 
@@ -39,7 +41,7 @@ void CServerEntityWrapper::save(IWriter& stream)
 	stream.open_chunk(1);
 
 	net_packet.w_begin(M_UPDATE);
-	m_object->UPDATE_Write(net_packet);
+	object().UPDATE_Write(net_packet);
 	stream.w_u16(u16(net_packet.B.count));
 	stream.w(net_packet.B.data, net_packet.B.count);
 
@@ -51,18 +53,31 @@ void CServerEntityWrapper::save(IWriter& stream)
 	stream.close_chunk();
 }
 
+// Only the packet locations are stored, the object is created on the first object() call
 void CServerEntityWrapper::load(IReader& stream)
 {
-	NET_Packet net_packet;
-	u16 ID;
 	IReader* chunk;
 
 	chunk = stream.open_chunk(0);
+	m_spawn_size = chunk->r_u16();
+	m_spawn_packet = (const u8*)chunk->pointer();
+	chunk->close();
 
-	net_packet.B.count = chunk->r_u16();
-	chunk->r(net_packet.B.data, net_packet.B.count);
-
+	chunk = stream.open_chunk(1);
+	m_update_size = chunk->r_u16();
+	m_update_packet = (const u8*)chunk->pointer();
 	chunk->close();
+}
+
+void CServerEntityWrapper::create_object() const
+{
+	VERIFY(m_spawn_packet && m_update_packet);
+
+	NET_Packet net_packet;
+	u16 ID;
+
+	net_packet.B.count = m_spawn_size;
+	CopyMemory(net_packet.B.data, m_spawn_packet, m_spawn_size);
 
 	net_packet.r_begin(ID);
 	R_ASSERT2(M_SPAWN == ID, "Invalid packet ID (!= M_SPAWN)!");
@@ -75,16 +90,37 @@ void CServerEntityWrapper::load(IReader& stream)
 	R_ASSERT3(m_object, "Can't create entity.", s_name);
 	m_object->Spawn_Read(net_packet);
 
-	chunk = stream.open_chunk(1);
-
-	net_packet.B.count = chunk->r_u16();
-	chunk->r(net_packet.B.data, net_packet.B.count);
-
-	chunk->close();
+	net_packet.B.count = m_update_size;
+	CopyMemory(net_packet.B.data, m_update_packet, m_update_size);
 
 	net_packet.r_begin(ID);
 	R_ASSERT2(M_UPDATE == ID, "Invalid packet ID (!= M_UPDATE)!");
 	m_object->UPDATE_Read(net_packet);
+
+#ifdef DEBUG
+	if (m_header.spawn_id != ALife::_SPAWN_ID(-1))
+	{
+		CSE_ALifeObject* alife_object = smart_cast<CSE_ALifeObject*>(m_object);
+		VERIFY3(m_header.spawn_id == m_object->m_tSpawnID, "Spawn header is out of date", m_object->name_replace());
+		VERIFY3(m_header.spawn_flags.get() == m_object->m_spawn_flags.get(), "Spawn header is out of date", m_object->name_replace());
+		VERIFY3(!alife_object || (m_header.spawn_story_id == alife_object->m_spawn_story_id), "Spawn header is out of date", m_object->name_replace());
+	}
+#endif
+}
+
+void CServerEntityWrapper::header(const SHeader& header)
+{
+	m_header = header;
+}
+
+void CServerEntityWrapper::build_header()
+{
+	CSE_Abstract& abstract = object();
+	CSE_ALifeObject* alife_object = smart_cast<CSE_ALifeObject*>(&abstract);
+
+	m_header.spawn_id = abstract.m_tSpawnID;
+	m_header.spawn_flags = abstract.m_spawn_flags;
+	m_header.spawn_story_id = alife_object ? alife_object->m_spawn_story_id : INVALID_SPAWN_STORY_ID;
 }
 
 void CServerEntityWrapper::save_update(IWriter& stream)
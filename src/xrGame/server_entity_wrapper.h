@@ -9,13 +9,32 @@
 #pragma once
 
 #include "object_interfaces.h"
+#include "alife_space.h"
 
 class CSE_Abstract;
 
 class CServerEntityWrapper : public IPureSerializeObject<IReader, IWriter>
 {
+public:
+	// what the spawn registry needs to walk the spawn graph without the object
+	struct SHeader
+	{
+		ALife::_SPAWN_ID spawn_id;
+		ALife::_SPAWN_STORY_ID spawn_story_id;
+		Flags32 spawn_flags;
+	};
+
 private:
-	CSE_Abstract* m_object;
+	mutable CSE_Abstract* m_object;
+	SHeader m_header;
+
+	// packets inside the spawn file, it stays mapped while the registry lives
+	const u8* m_spawn_packet;
+	const u8* m_update_packet;
+	u16 m_spawn_size;
+	u16 m_update_size;
+
+	void create_object() const;
 
 public:
 	IC CServerEntityWrapper(CSE_Abstract* object = 0);
@@ -25,6 +44,10 @@ public:
 	void save_update(IWriter& stream);
 	void load_update(IReader& stream);
 	IC CSE_Abstract& object() const;
+	IC bool loaded() const;
+	IC const SHeader& header() const;
+	void header(const SHeader& header);
+	void build_header();
 };
 
 #include "server_entity_wrapper_inline.h"
@@ -11,10 +11,30 @@
 IC CServerEntityWrapper::CServerEntityWrapper(CSE_Abstract* object)
 {
 	m_object = object;
+	m_spawn_packet = 0;
+	m_update_packet = 0;
+	m_spawn_size = 0;
+	m_update_size = 0;
+	m_header.spawn_id = ALife::_SPAWN_ID(-1);
+	m_header.spawn_story_id = INVALID_SPAWN_STORY_ID;
+	m_header.spawn_flags.zero();
 }
 
 IC CSE_Abstract& CServerEntityWrapper::object() const
 {
+	if (!m_object)
+		create_object();
+
 	VERIFY(m_object);
 	return (*m_object);
 }
+
+IC bool CServerEntityWrapper::loaded() const
+{
+	return (!!m_object);
+}
+
+IC const CServerEntityWrapper::SHeader& CServerEntityWrapper::header() const
+{
+	return (m_header);
+}
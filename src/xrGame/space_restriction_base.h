@@ -25,7 +25,7 @@ protected:
 	void process_borders();
 
 public:
-	bool inside(u32 level_vertex_id, bool partially_inside);
+	virtual bool inside(u32 level_vertex_id, bool partially_inside);
 	bool inside(u32 level_vertex_id, bool partially_inside, float radius);
 	virtual bool inside(const Fsphere& sphere) = 0;
 	virtual bool shape() const = 0;
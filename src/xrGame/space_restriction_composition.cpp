@@ -74,6 +74,31 @@ bool CSpaceRestrictionComposition::inside(const Fsphere& sphere)
 	return (false);
 }
 
+bool CSpaceRestrictionComposition::inside(u32 level_vertex_id, bool partially_inside)
+{
+	if (!initialized())
+		return (CSpaceRestrictionBase::inside(level_vertex_id, partially_inside));
+
+	// answered by the parts as long as one of them decides; a vertex only partially inside
+	// several parts may still be completely inside the union, that one is tested directly
+	bool partially = false;
+	RESTRICTIONS::iterator I = m_restrictions.begin();
+	RESTRICTIONS::iterator E = m_restrictions.end();
+	for (; I != E; ++I)
+	{
+		if ((*I)->inside(level_vertex_id, partially_inside))
+			return (true);
+
+		if (!partially_inside && !partially)
+			partially = (*I)->inside(level_vertex_id, true);
+	}
+
+	if (!partially)
+		return (false);
+
+	return (CSpaceRestrictionBase::inside(level_vertex_id, false));
+}
+
 void CSpaceRestrictionComposition::initialize()
 {
 	u32 n = _GetItemCount(*m_space_restrictors);
@@ -42,6 +42,7 @@ public:
 	virtual ~CSpaceRestrictionComposition();
 	virtual void initialize();
 	virtual bool inside(const Fsphere& sphere);
+	virtual bool inside(u32 level_vertex_id, bool partially_inside);
 	IC virtual shared_str name() const;
 	IC virtual bool shape() const;
 	IC virtual bool default_restrictor() const;
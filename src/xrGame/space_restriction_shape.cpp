@@ -12,6 +12,7 @@
 #include "level_graph.h"
 #include "space_restrictor.h"
 #include "graph_engine.h"
+#include "../xrcore/xr_parallel.h"
 
 struct CBorderMergePredicate
 {
@@ -22,13 +23,6 @@ struct CBorderMergePredicate
 		m_restriction = restriction;
 	}
 
-	IC void operator()(const CLevelGraph::CVertex& vertex) const
-	{
-		if (m_restriction->inside(ai().level_graph().vertex_id(&vertex), true) && !m_restriction->inside(
-			ai().level_graph().vertex_id(&vertex), false))
-			m_restriction->m_border.push_back(ai().level_graph().vertex_id(&vertex));
-	}
-
 	IC bool operator()(u32 level_vertex_id) const
 	{
 		return (m_restriction->inside(level_vertex_id, false));
@@ -54,7 +48,7 @@ struct CShapeTestPredicate {
 #endif
 
 
-void CSpaceRestrictionShape::fill_shape(const CCF_Shape::shape_def& shape)
+void CSpaceRestrictionShape::fill_shape(const CCF_Shape::shape_def& shape, VERTEX_RUNS& runs)
 {
 	Fvector start, dest;
 	switch (shape.type)
@@ -98,22 +92,141 @@ void CSpaceRestrictionShape::fill_shape(const CCF_Shape::shape_def& shape)
 		}
 	default: NODEFAULT;
 	}
-	ai().level_graph().iterate_vertices(start, dest, CBorderMergePredicate(this));
+
+	// the cells of the bounding rectangle and the ones around it, their vertices may be partially inside
+	const CLevelGraph& level_graph = ai().level_graph();
+	const Fbox& box = level_graph.header().box();
+	float cell_size = level_graph.header().cell_size();
+	int x0 = iFloor((start.x - box.min.x) / cell_size + .5f) - 1;
+	int z0 = iFloor((start.z - box.min.z) / cell_size + .5f) - 1;
+	int x1 = iFloor((dest.x - box.min.x) / cell_size + .5f) + 1;
+	int z1 = iFloor((dest.z - box.min.z) / cell_size + .5f) + 1;
+	if ((x1 < 0) || (z1 < 0) || (x0 > int(level_graph.max_x())) || (z0 > int(level_graph.max_z())))
+		return;
+
+	x0 = _max(x0, 0);
+	z0 = _max(z0, 0);
+	x1 = _min(x1, int(level_graph.max_x()));
+	z1 = _min(z1, int(level_graph.max_z()));
+
+	for (int x = x0; x <= x1; ++x)
+	{
+		const CLevelGraph::CVertex *begin, *end;
+		level_graph.column(u32(x), u32(z0), u32(z1), begin, end);
+		if (begin == end)
+			continue;
+
+		SVertexRun run;
+		run.m_first_vertex = level_graph.vertex_id(begin);
+		run.m_vertex_count = u32(end - begin);
+		run.m_offset = 0;
+		runs.push_back(run);
+	}
 
 #ifdef DEBUG
 	ai().level_graph().iterate_vertices(start,dest,CShapeTestPredicate(this));
 #endif
 }
 
+void CSpaceRestrictionShape::rasterize(VERTEX_RUNS& runs)
+{
+	// the restrictor prepares its shapes on the first query, the workers only read them
+	Fsphere temp;
+	temp.P = m_restrictor->Position();
+	temp.R = 0.f;
+	m_restrictor->inside(temp);
+
+	// the columns of overlapping shapes overlap as well
+	std::sort(runs.begin(), runs.end());
+	m_runs.clear();
+	for (VERTEX_RUNS::const_iterator I = runs.begin(); I != runs.end(); ++I)
+	{
+		if (m_runs.empty() || ((*I).m_first_vertex > m_runs.back().m_first_vertex + m_runs.back().m_vertex_count))
+		{
+			m_runs.push_back(*I);
+			continue;
+		}
+
+		SVertexRun& run = m_runs.back();
+		run.m_vertex_count = _max(run.m_vertex_count, (*I).m_first_vertex + (*I).m_vertex_count - run.m_first_vertex);
+	}
+
+	u32 word_count = 0;
+	for (VERTEX_RUNS::iterator I = m_runs.begin(); I != m_runs.end(); ++I)
+	{
+		(*I).m_offset = 16 * word_count;
+		word_count += ((*I).m_vertex_count + 15) / 16;
+	}
+
+	m_inside.assign(word_count, 0);
+
+	// every word holds 16 vertices of a single run, so workers never share one
+	xr_parallel_for(0, word_count, 16, [&](u32 word)
+	{
+		VERTEX_RUNS::const_iterator I = std::upper_bound(m_runs.begin(), m_runs.end(), 16 * word,
+			[](u32 offset, const SVertexRun& run) { return (offset < run.m_offset); });
+		const SVertexRun& run = *(I - 1);
+
+		u32 index = 16 * word - run.m_offset;
+		u32 begin = run.m_first_vertex + index;
+		u32 end = run.m_first_vertex + _min(index + 16, run.m_vertex_count);
+
+		u32 bits = 0;
+		for (u32 i = begin; i < end; ++i)
+		{
+			if (!CSpaceRestrictionBase::inside(i, true))
+				continue;
+
+			bits |= 1 << (2 * (i - begin));
+			if (CSpaceRestrictionBase::inside(i, false))
+				bits |= 2 << (2 * (i - begin));
+		}
+		m_inside[word] = bits;
+	});
+
+	m_inside_xform = m_restrictor->XFORM();
+}
+
+bool CSpaceRestrictionShape::inside(u32 level_vertex_id, bool partially_inside)
+{
+	if (memcmp(&m_inside_xform, &m_restrictor->XFORM(), sizeof(Fmatrix)))
+		return (CSpaceRestrictionBase::inside(level_vertex_id, partially_inside));
+
+	VERTEX_RUNS::const_iterator I = std::upper_bound(m_runs.begin(), m_runs.end(), level_vertex_id,
+		[](u32 vertex_id, const SVertexRun& run) { return (vertex_id < run.m_first_vertex); });
+	if (I == m_runs.begin())
+		return (CSpaceRestrictionBase::inside(level_vertex_id, partially_inside));
+
+	--I;
+	u32 index = level_vertex_id - (*I).m_first_vertex;
+	if (index >= (*I).m_vertex_count)
+		return (CSpaceRestrictionBase::inside(level_vertex_id, partially_inside));
+
+	index += (*I).m_offset;
+	u32 bits = m_inside[index / 16] >> (2 * (index % 16));
+	return (!!(bits & (partially_inside ? 1 : 2)));
+}
+
 void CSpaceRestrictionShape::build_border()
 {
 	m_border.clear();
 	CCF_Shape* shape = smart_cast<CCF_Shape*>(m_restrictor->collidable.model);
 	VERIFY(shape);
+
+	VERTEX_RUNS runs;
 	xr_vector<CCF_Shape::shape_def>::const_iterator I = shape->Shapes().begin();
 	xr_vector<CCF_Shape::shape_def>::const_iterator E = shape->Shapes().end();
 	for (; I != E; ++I)
-		fill_shape(*I);
+		fill_shape(*I, runs);
+
+	rasterize(runs);
+
+	for (VERTEX_RUNS::const_iterator i = m_runs.begin(); i != m_runs.end(); ++i)
+	{
+		for (u32 vertex_id = (*i).m_first_vertex, n = vertex_id + (*i).m_vertex_count; vertex_id < n; ++vertex_id)
+			if (inside(vertex_id, true) && !inside(vertex_id, false))
+				m_border.push_back(vertex_id);
+	}
 
 	{
 		m_border.erase(
@@ -25,16 +25,39 @@ protected:
 	CSpaceRestrictor* m_restrictor;
 	bool m_default;
 
+	// a run of consecutive level vertex ids, the part of one x column a shape covers
+	struct SVertexRun
+	{
+		u32 m_first_vertex;
+		u32 m_vertex_count;
+		u32 m_offset; // of its first vertex in m_inside, every run starts a new word
+
+		IC bool operator<(const SVertexRun& other) const
+		{
+			return (m_first_vertex < other.m_first_vertex);
+		}
+	};
+
+	typedef xr_vector<SVertexRun> VERTEX_RUNS;
+
+	// the restrictor rasterized over the vertex runs its shapes cover, two bits per vertex:
+	// partially and completely inside; valid while the restrictor stays where it was rasterized
+	VERTEX_RUNS m_runs;
+	xr_vector<u32> m_inside;
+	Fmatrix m_inside_xform;
+
 protected:
 	IC Fvector position(const CCF_Shape::shape_def& data) const;
 	IC float radius(const CCF_Shape::shape_def& data) const;
 	void build_border();
-	void fill_shape(const CCF_Shape::shape_def& shape);
+	void fill_shape(const CCF_Shape::shape_def& shape, VERTEX_RUNS& runs);
+	void rasterize(VERTEX_RUNS& runs);
 
 public:
 	IC CSpaceRestrictionShape(CSpaceRestrictor* space_restrictor, bool default_restrictor);
 	IC virtual void initialize();
 	virtual bool inside(const Fsphere& sphere);
+	virtual bool inside(u32 level_vertex_id, bool partially_inside);
 	virtual shared_str name() const;
 	IC virtual bool shape() const;
 	IC virtual bool default_restrictor() const;
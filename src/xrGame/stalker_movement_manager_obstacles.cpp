@@ -19,6 +19,7 @@
 #include "doors_actor.h"
 #include "doors_manager.h"
 #include "level_path_builder.h"
+#include "moving_objects.h"
 
 #ifndef MASTER_GOLD
 #	include "ai_debug.h"
@@ -141,6 +142,10 @@ bool stalker_movement_manager_obstacles::can_build_restricted_path(const obstacl
 void stalker_movement_manager_obstacles::move_along_path_impl(CPHMovementControl* movement_control,
                                                               Fvector& dest_position, float time_delta)
 {
+	// goes first: objects it resolves are skipped by the dynamic obstacles query below
+	float speed_factor = 1.f;
+	ai().moving_objects().crowd_speed_factor(object().get_moving_object(), speed_factor);
+
 #ifndef MASTER_GOLD
 	if (psAI_Flags.test(aiObstaclesAvoidingStatic))
 #endif // MASTER_GOLD
@@ -169,6 +174,17 @@ void stalker_movement_manager_obstacles::move_along_path_impl(CPHMovementControl
 		m_static_obstacles.need_path_to_rebuild())
 		rebuild_path();
 
+	if (speed_factor < 1.f)
+	{
+		float desirable_speed = old_desirable_speed();
+		set_desirable_speed(desirable_speed * speed_factor);
+
+		inherited::move_along_path(movement_control, dest_position, time_delta);
+
+		set_desirable_speed(desirable_speed);
+		return;
+	}
+
 	inherited::move_along_path(movement_control, dest_position, time_delta);
 }
 
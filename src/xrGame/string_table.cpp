@@ -111,17 +111,20 @@ void CStringTable::Load(LPCSTR xml_file_full, LPCSTR lang_in)
 
 	uiXml.Load(CONFIG_PATH, _s, xml_file_full);
 
-	//      
-	int string_num = uiXml.GetNodesNum(uiXml.GetRoot(), "string");
+	// walk the strings in one pass, indexed reads navigate from the first string every time
+	XML_NODE* root = uiXml.GetRoot();
+	if (!root)
+		return;
 
-	for (int i = 0; i < string_num; ++i)
+	//      
+	for (XML_NODE* node = root->FirstChild("string"); node; node = root->IterateChildren("string", node))
 	{
-		LPCSTR string_name = uiXml.ReadAttrib(uiXml.GetRoot(), "string", i, "id", NULL);
+		LPCSTR string_name = uiXml.ReadAttrib(node, "id", NULL);
 
 		VERIFY3(pData->m_StringTable.find(string_name) == pData->m_StringTable.end(), "duplicate string table id",
 		        string_name);
 
-		LPCSTR string_text = uiXml.Read(uiXml.GetRoot(), "string:text", i, NULL);
+		LPCSTR string_text = uiXml.Read(node->FirstChild("text"), NULL);
 
 		if (m_bWriteErrorsToLog && string_text)
 			Msg("[string table] '%s' no translation in '%s'", string_name, lang);
@@ -227,8 +230,9 @@ STRING_VALUE CStringTable::translate(const STRING_ID& str_id) const
 {
 	VERIFY(pData);
 
-	if (pData->m_StringTable.find(str_id) != pData->m_StringTable.end())
-		return pData->m_StringTable[str_id];
+	STRING_TABLE_MAP_IT it = pData->m_StringTable.find(str_id);
+	if (it != pData->m_StringTable.end())
+		return it->second;
 	else
 		return str_id;
 }
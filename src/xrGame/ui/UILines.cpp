@@ -120,6 +120,60 @@ void CUILines::Reset()
 	m_lines.clear();
 }
 
+// Lines of the recently parsed texts, most recent first. The same texts are parsed over and over
+// as windows are shown, resized and refilled, the lines only depend on what goes into the key.
+// The font is identified by its metrics as well as its address, fonts are reinitialized in place.
+namespace ui_lines_cache
+{
+	static const u32 max_entries = 256;
+
+	struct entry
+	{
+		u64 key;
+		shared_str text; // keeps the text, and so its address in the key, alive
+		CUILines::LinesVector lines;
+	};
+
+	typedef xr_list<entry> ENTRIES;
+	typedef xr_unordered_map<u64, ENTRIES::iterator> INDEX;
+
+	static ENTRIES entries;
+	static INDEX index;
+}
+
+void CUILines::ClearLayoutCache()
+{
+	ui_lines_cache::entries.clear();
+	ui_lines_cache::index.clear();
+}
+
+u64 CUILines::LayoutKey() const
+{
+	struct
+	{
+		const void* text;
+		const CGameFont* font;
+		float width;
+		float scale;
+		float font_height;
+		float font_step;
+		u32 color;
+		u32 flags;
+	} key;
+
+	ZeroMemory(&key, sizeof(key));
+	key.text = m_text._get();
+	key.font = m_pFont;
+	key.width = m_wndSize.x;
+	key.scale = 1.0f;
+	UI().ClientToScreenScaledWidth(key.scale);
+	key.font_height = m_pFont->GetHeight();
+	key.font_step = m_pFont->SizeOf_('o');
+	key.color = GetTextColor();
+	key.flags = uFlags.get() & (flColoringMode | flRecognizeNewLine);
+	return (hash64(&key, sizeof(key)));
+}
+
 float get_str_width(CGameFont* pFont, char ch)
 {
 	float ll = pFont->SizeOf_(ch);
@@ -137,6 +191,16 @@ void CUILines::ParseText(bool force)
 
 	Reset();
 
+	u64 key = LayoutKey();
+	ui_lines_cache::INDEX::iterator cached = ui_lines_cache::index.find(key);
+	if (cached != ui_lines_cache::index.end() && (*cached).second->text == m_text)
+	{
+		ui_lines_cache::entries.splice(ui_lines_cache::entries.begin(), ui_lines_cache::entries, (*cached).second);
+		m_lines = (*cached).second->lines;
+		uFlags.set(flNeedReparse, FALSE);
+		return;
+	}
+
 	CUILine* line = NULL;
 	if (uFlags.test(flColoringMode))
 		line = ParseTextToColoredLine(m_text.c_str());
@@ -309,6 +373,25 @@ void CUILines::ParseText(bool force)
 	}
 	xr_delete(line);
 	uFlags.set(flNeedReparse, FALSE);
+
+	if (cached != ui_lines_cache::index.end())
+	{
+		// another text under the same hash, the newer one takes the slot
+		ui_lines_cache::entries.erase((*cached).second);
+		ui_lines_cache::index.erase(cached);
+	}
+	else if (ui_lines_cache::entries.size() >= ui_lines_cache::max_entries)
+	{
+		ui_lines_cache::index.erase(ui_lines_cache::entries.back().key);
+		ui_lines_cache::entries.pop_back();
+	}
+
+	ui_lines_cache::entries.push_front(ui_lines_cache::entry());
+	ui_lines_cache::entry& stored = ui_lines_cache::entries.front();
+	stored.key = key;
+	stored.text = m_text;
+	stored.lines = m_lines;
+	ui_lines_cache::index[key] = ui_lines_cache::entries.begin();
 }
 
 float CUILines::GetVisibleHeight()
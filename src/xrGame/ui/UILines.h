@@ -45,6 +45,8 @@ public:
 	// own methods
 	void Reset();
 	void ParseText(bool force = false);
+	// parsed lines are shared between all the controls, fonts changing their metrics must drop them
+	static void ClearLayoutCache();
 	float GetVisibleHeight();
 
 	Fvector2 m_TextOffset;
@@ -61,6 +63,7 @@ protected:
 	float GetIndentByAlign() const;
 	float GetVIndentByAlign();
 	void CutFirstColoredTextEntry(xr_string& entry, u32& color, xr_string& text) const;
+	u64 LayoutKey() const;
 
 	shared_str m_text;
 
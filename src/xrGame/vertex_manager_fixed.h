@@ -8,6 +8,8 @@
 
 #pragma once
 
+#include <xmmintrin.h>
+
 template <
 	typename _path_id_type,
 	typename _index_type,
@@ -80,6 +82,7 @@ struct CVertexManagerFixed
 		IC void add_opened(CGraphVertex& vertex);
 		IC void add_closed(CGraphVertex& vertex);
 		IC _path_id_type current_path_id() const;
+		IC void prefetch(const _index_type& vertex_id) const;
 	};
 };
 
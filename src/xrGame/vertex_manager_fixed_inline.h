@@ -112,5 +112,12 @@ IC typename CFixedVertexManager::_path_id_type CFixedVertexManager::current_path
 	return (m_current_path_id);
 }
 
+TEMPLATE_SPECIALIZATION
+IC void CFixedVertexManager::prefetch(const _index_type& vertex_id) const
+{
+	VERIFY(vertex_id < m_max_node_count);
+	_mm_prefetch((const char*)(m_indexes + vertex_id), _MM_HINT_T0);
+}
+
 #undef TEMPLATE_SPECIALIZATION
 #undef CFixedVertexManager
@@ -118,122 +118,179 @@ void dump_URL(LPCSTR p, IDirectPlay8Address* A)
 }
 
 // 
-INetQueue::INetQueue()
-#ifdef PROFILE_CRITICAL_SECTIONS
-	:cs(MUTEX_PROFILE_ID(INetQueue))
-#endif // PROFILE_CRITICAL_SECTIONS
+INetQueue::INetQueue() :
+	arena_reserved(0),
+	arena_released(0),
+	current(NULL)
 {
-	unused.reserve(128);
-	for (int i = 0; i < 16; i++)
-		unused.push_back(xr_new<NET_Packet>());
+	arena = (u8*)xr_malloc(arena_size);
+	ZeroMemory(arena, arena_size);
+
+	ZeroMemory(&stub, sizeof(stub));
+	head = &stub;
+	tail = &stub;
 }
 
 INetQueue::~INetQueue()
 {
-	cs.Enter();
-	u32 it;
-	for (it = 0; it < unused.size(); it++) xr_delete(unused[it]);
-	for (it = 0; it < ready.size(); it++) xr_delete(ready[it]);
-	cs.Leave();
+	if (current)
+		Release();
+
+	while (record* R = pop())
+		free_record(R);
+
+	xr_free(arena);
 }
 
-static u32 LastTimeCreate = 0;
+// Arena positions grow monotonically and wrap at 2^32, arena_size divides that. The reserving
+// producer owns a record until it is pushed; the consumer marks it released and then moves
+// arena_released over every released record at the front, clearing them, so that a header that
+// was not written yet always reads as not released. A record that would cross the end of the arena
+// is preceded by a released pad up to the end.
+INetQueue::record* INetQueue::allocate_record(u32 size)
+{
+	STATIC_CHECK((arena_size & (arena_size - 1)) == 0, Arena_size_must_be_a_power_of_two);
+	STATIC_CHECK(sizeof(record) <= record_alignment, Record_header_must_fit_into_alignment);
 
-NET_Packet* INetQueue::Create()
+	u32 extent = (sizeof(record) + size + record_alignment - 1) & ~(record_alignment - 1);
+	if (extent <= arena_size / 4)
+	{
+		for (;;)
+		{
+			u32 reserved = u32(arena_reserved);
+			u32 released = u32(arena_released);
+			u32 offset = reserved & (arena_size - 1);
+			u32 pad = (offset + extent > arena_size) ? arena_size - offset : 0;
+			if (reserved + pad + extent - released > arena_size)
+				break;
+
+			if (u32(InterlockedCompareExchange(&arena_reserved, LONG(reserved + pad + extent), LONG(reserved))) != reserved)
+				continue;
+
+			if (pad)
+			{
+				record* P = (record*)(arena + offset);
+				P->extent = pad;
+				InterlockedExchange(&P->released, 1);
+				offset = 0;
+			}
+
+			record* R = (record*)(arena + offset);
+			R->extent = extent;
+			return R;
+		}
+	}
+
+	// arena is full, a burst of spawns at level load, or a huge message
+	record* R = (record*)xr_malloc(sizeof(record) + size);
+	R->extent = 0;
+	R->released = 0;
+	return R;
+}
+
+void INetQueue::free_record(record* R)
 {
-	NET_Packet* P = 0;
-	//cs.Enter		();
-	//#ifdef _DEBUG
-	//		Msg ("- INetQueue::Create - ready %d, unused %d", ready.size(), unused.size());
-	//#endif
-	if (unused.empty())
+	if (!R->extent)
 	{
-		ready.push_back(xr_new<NET_Packet>());
-		P = ready.back();
-		//---------------------------------------------
-		LastTimeCreate = GetTickCount();
-		//---------------------------------------------
+		xr_free(R);
+		return;
 	}
-	else
+
+	InterlockedExchange(&R->released, 1);
+
+	for (;;)
 	{
-		ready.push_back(unused.back());
-		unused.pop_back();
-		P = ready.back();
+		u32 released = u32(arena_released);
+		if (released == u32(arena_reserved))
+			break;
+
+		record* F = (record*)(arena + (released & (arena_size - 1)));
+		if (!F->released)
+			break;
+
+		u32 extent = F->extent;
+		ZeroMemory(F, extent);
+		InterlockedExchange(&arena_released, LONG(released + extent));
 	}
-	//cs.Leave		();
-	return P;
 }
 
-NET_Packet* INetQueue::Create(const NET_Packet& _other)
+// intrusive MPSC list with a stub node, pushing is a single exchange
+void INetQueue::push(record* R)
+{
+	R->next = NULL;
+	record* prev = (record*)InterlockedExchangePointer((PVOID volatile*)&head, R);
+	prev->next = R;
+}
+
+INetQueue::record* INetQueue::pop()
 {
-	NET_Packet* P = 0;
-	cs.Enter();
-	//#ifdef _DEBUG
-	//		Msg ("- INetQueue::Create - ready %d, unused %d", ready.size(), unused.size());
-	//#endif
-	if (unused.empty())
+	record* R = tail;
+	record* next = R->next;
+
+	if (R == &stub)
+	{
+		if (!next)
+			return NULL;
+		tail = next;
+		R = next;
+		next = next->next;
+	}
+
+	if (next)
 	{
-		ready.push_back(xr_new<NET_Packet>());
-		P = ready.back();
-		//---------------------------------------------
-		LastTimeCreate = GetTickCount();
-		//---------------------------------------------
+		tail = next;
+		return R;
 	}
-	else
+
+	// R is the last one or a producer is between the exchange and the link
+	if (R != head)
+		return NULL;
+
+	push(&stub);
+
+	next = R->next;
+	if (next)
 	{
-		ready.push_back(unused.back());
-		unused.pop_back();
-		P = ready.back();
+		tail = next;
+		return R;
 	}
-	CopyMemory(P, &_other, sizeof(NET_Packet));
-	cs.Leave();
-	return P;
+
+	return NULL;
+}
+
+void INetQueue::Push(const void* data, u32 size, u32 time_receive)
+{
+	VERIFY(size <= NET_PacketSizeLimit);
+
+	record* R = allocate_record(size);
+	R->size = size;
+	R->time_receive = time_receive;
+	CopyMemory(R + 1, data, size);
+	push(R);
 }
 
 NET_Packet* INetQueue::Retreive()
 {
-	NET_Packet* P = 0;
-	//cs.Enter		();
-	//#ifdef _DEBUG
-	//			Msg ("INetQueue::Retreive - ready %d, unused %d", ready.size(), unused.size());
-	//#endif
-	if (!ready.empty()) P = ready.front();
-		//---------------------------------------------	
-	else
+	if (!current)
 	{
-		u32 tmp_time = GetTickCount() - 60000;
-		u32 size = unused.size();
-		if ((LastTimeCreate < tmp_time) && (size > 32))
-		{
-			xr_delete(unused.back());
-			unused.pop_back();
-		}
+		current = pop();
+		if (!current)
+			return NULL;
+
+		packet.construct(current + 1, current->size);
+		packet.r_pos = 0;
+		packet.timeReceive = current->time_receive;
 	}
-	//---------------------------------------------	
-	//cs.Leave		();
-	return P;
+
+	return &packet;
 }
 
 void INetQueue::Release()
 {
-	//cs.Enter		();
-	//#ifdef _DEBUG
-	//		Msg ("INetQueue::Release - ready %d, unused %d", ready.size(), unused.size());
-	//#endif
-	VERIFY(!ready.empty());
-	//---------------------------------------------
-	u32 tmp_time = GetTickCount() - 60000;
-	u32 size = unused.size();
-	ready.front()->B.count = 0;
-	if ((LastTimeCreate < tmp_time) && (size > 32))
-	{
-		xr_delete(ready.front());
-	}
-	else
-		unused.push_back(ready.front());
-	//---------------------------------------------	
-	ready.pop_front();
-	//cs.Leave		();
+	VERIFY(current);
+	free_record(current);
+	current = NULL;
+	packet.B.count = 0;
 }
 
 //
@@ -965,15 +1022,7 @@ HRESULT IPureClient::net_Handler(u32 dwMessageType, PVOID pMessage)
 void IPureClient::OnMessage(void* data, u32 size)
 {
 	// One of the messages - decompress it
-	net_Queue.Lock();
-	NET_Packet* P = net_Queue.Create();
-
-	P->construct(data, size);
-	P->timeReceive = timeServer_Async(); //TimerAsync				(device_timer);	
-
-	u16 m_type;
-	P->r_begin(m_type);
-	net_Queue.Unlock();
+	net_Queue.Push(data, size, timeServer_Async()); //TimerAsync				(device_timer);	
 }
 
 void IPureClient::timeServer_Correct(u32 sv_time, u32 cl_time)
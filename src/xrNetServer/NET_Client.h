@@ -5,21 +5,50 @@
 
 struct ip_address;
 
+// Received messages, pushed by any thread, consumed by the thread running the client.
+// Every message is one record of its own size: header and payload are carved out of a ring arena,
+// or allocated on the heap when the arena is full, and linked into an intrusive MPSC list. Neither
+// side takes a lock, so the receive thread never waits for the client to finish processing.
 class XRNETSERVER_API INetQueue
 {
-	xrCriticalSection cs;
-	xr_deque<NET_Packet*> ready;
-	xr_vector<NET_Packet*> unused;
+	struct record
+	{
+		record* volatile next;
+		u32 size;
+		u32 time_receive;
+		u32 extent; // bytes taken in the arena, 0 for records on the heap
+		volatile LONG released;
+	};
+
+	enum
+	{
+		arena_size = 256 * 1024,
+		record_alignment = 32,
+	};
+
+	u8* arena;
+	volatile LONG arena_reserved;
+	volatile LONG arena_released;
+
+	record* volatile head;
+	record* tail;
+	record stub;
+
+	record* current;
+	NET_Packet packet;
+
+	record* allocate_record(u32 size);
+	void free_record(record* R);
+	void push(record* R);
+	record* pop();
+
 public:
 	INetQueue();
 	~INetQueue();
 
-	NET_Packet* Create();
-	NET_Packet* Create(const NET_Packet& _other);
+	void Push(const void* data, u32 size, u32 time_receive);
 	NET_Packet* Retreive();
 	void Release();
-	inline void Lock() { cs.Enter(); };
-	inline void Unlock() { cs.Leave(); };
 };
 
 
@@ -95,10 +124,8 @@ public:
 	LPCSTR net_SessionName() { return *(net_Hosts.front().dpSessionName); }
 
 	// receive
-	IC void StartProcessQueue() { net_Queue.Lock(); }; // WARNING ! after Start mast be End !!! <-
-	IC virtual NET_Packet* net_msg_Retreive() { return net_Queue.Retreive(); }; //							|
-	IC void net_msg_Release() { net_Queue.Release(); }; //							|
-	IC void EndProcessQueue() { net_Queue.Unlock(); }; //							<-
+	IC virtual NET_Packet* net_msg_Retreive() { return net_Queue.Retreive(); };
+	IC void net_msg_Release() { net_Queue.Release(); };
 
 	// send
 	virtual void Send(NET_Packet& P, u32 dwFlags = DPNSEND_GUARANTEED, u32 dwTimeout = 0);
@@ -0,0 +1,217 @@
+#include "stdafx.h"
+#include "PHBroadphase.h"
+
+CPHBroadphase::CPHBroadphase()
+{
+	m_pairs_added = 0;
+	m_pairs_removed = 0;
+}
+
+CPHBroadphase::~CPHBroadphase()
+{
+	clear();
+}
+
+void CPHBroadphase::clear()
+{
+	xr_vector<SProxy>::iterator i = m_proxies.begin(), e = m_proxies.end();
+	for (; e != i; ++i)
+		if (i->object)
+			i->object->m_broadphase_id = invalid_id;
+
+	m_proxies.clear();
+	m_free.clear();
+	m_endpoints.clear();
+	m_moved.clear();
+}
+
+void CPHBroadphase::fetch_bounds(SProxy& proxy)
+{
+	const Fvector& center = proxy.object->spatial.sphere.P;
+	const Fvector& extents = proxy.object->AABB;
+	proxy.min.sub(center, extents);
+	proxy.max.add(center, extents);
+}
+
+void CPHBroadphase::add(CPHObject* object)
+{
+	if (object->m_broadphase_id != invalid_id) return;
+
+	u32 id;
+	if (m_free.empty())
+	{
+		id = m_proxies.size();
+		m_proxies.push_back(SProxy());
+		m_proxies.back().moved = false;
+	}
+	else
+	{
+		id = m_free.back();
+		m_free.pop_back();
+	}
+
+	SProxy& proxy = m_proxies[id];
+	proxy.object = object;
+	proxy.partners.clear_not_free();
+	object->m_broadphase_id = id;
+	fetch_bounds(proxy);
+
+	// appended out of order, sort() will move them in place and report the new pairs
+	SEndpoint endpoint;
+	endpoint.value = proxy.min.x;
+	endpoint.data = id;
+	proxy.endpoints[0] = m_endpoints.size();
+	m_endpoints.push_back(endpoint);
+	endpoint.value = proxy.max.x;
+	endpoint.data = id | max_flag;
+	proxy.endpoints[1] = m_endpoints.size();
+	m_endpoints.push_back(endpoint);
+
+	if (!proxy.moved)
+	{
+		proxy.moved = true;
+		m_moved.push_back(id);
+	}
+}
+
+void CPHBroadphase::remove(CPHObject* object)
+{
+	u32 id = object->m_broadphase_id;
+	if (id == invalid_id) return;
+
+	SProxy& proxy = m_proxies[id];
+	xr_vector<u32>::iterator i = proxy.partners.begin(), e = proxy.partners.end();
+	for (; e != i; ++i)
+	{
+		xr_vector<u32>& partners = m_proxies[*i].partners;
+		partners.erase(std::find(partners.begin(), partners.end(), id));
+		++m_pairs_removed;
+	}
+	proxy.partners.clear_not_free();
+
+	u32 first = _min(proxy.endpoints[0], proxy.endpoints[1]);
+	u32 last = _max(proxy.endpoints[0], proxy.endpoints[1]);
+	m_endpoints.erase(m_endpoints.begin() + last);
+	m_endpoints.erase(m_endpoints.begin() + first);
+	for (u32 k = first, n = m_endpoints.size(); k < n; ++k)
+		m_proxies[m_endpoints[k].proxy()].endpoints[m_endpoints[k].is_max()] = k;
+
+	proxy.object = NULL;
+	object->m_broadphase_id = invalid_id;
+	m_free.push_back(id);
+}
+
+void CPHBroadphase::move(CPHObject* object)
+{
+	u32 id = object->m_broadphase_id;
+	if (id == invalid_id) return;
+
+	SProxy& proxy = m_proxies[id];
+	if (proxy.moved) return;
+	proxy.moved = true;
+	m_moved.push_back(id);
+}
+
+void CPHBroadphase::update()
+{
+	if (m_moved.empty()) return;
+
+	m_pairs_added = 0;
+	m_pairs_removed = 0;
+
+	xr_vector<u32>::iterator i = m_moved.begin(), e = m_moved.end();
+	for (; e != i; ++i)
+	{
+		SProxy& proxy = m_proxies[*i];
+		proxy.moved = false;
+		if (!proxy.object) continue;
+
+		fetch_bounds(proxy);
+		m_endpoints[proxy.endpoints[0]].value = proxy.min.x;
+		m_endpoints[proxy.endpoints[1]].value = proxy.max.x;
+	}
+	m_moved.clear_not_free();
+
+	sort();
+}
+
+// Insertion sort: objects move little between steps, so the endpoints are nearly sorted and every
+// swap is exactly one crossing of two endpoints. Only a min crossing a max can change overlap.
+void CPHBroadphase::sort()
+{
+	for (u32 k = 1, n = m_endpoints.size(); k < n; ++k)
+	{
+		SEndpoint key = m_endpoints[k];
+		u32 j = k;
+		for (; j > 0 && key < m_endpoints[j - 1]; --j)
+		{
+			const SEndpoint& other = m_endpoints[j - 1];
+			if (key.is_max() != other.is_max())
+				on_swap(key.proxy(), other.proxy());
+
+			m_endpoints[j] = other;
+			m_proxies[other.proxy()].endpoints[other.is_max()] = j;
+		}
+
+		if (j != k)
+		{
+			m_endpoints[j] = key;
+			m_proxies[key.proxy()].endpoints[key.is_max()] = j;
+		}
+	}
+}
+
+void CPHBroadphase::on_swap(u32 proxy0, u32 proxy1)
+{
+	if (proxy0 == proxy1) return;
+
+	if (overlap_x(m_proxies[proxy0], m_proxies[proxy1]))
+		add_pair(proxy0, proxy1);
+	else
+		remove_pair(proxy0, proxy1);
+}
+
+void CPHBroadphase::add_pair(u32 proxy0, u32 proxy1)
+{
+	xr_vector<u32>& partners0 = m_proxies[proxy0].partners;
+	if (std::find(partners0.begin(), partners0.end(), proxy1) != partners0.end()) return;
+
+	partners0.push_back(proxy1);
+	m_proxies[proxy1].partners.push_back(proxy0);
+	++m_pairs_added;
+}
+
+void CPHBroadphase::remove_pair(u32 proxy0, u32 proxy1)
+{
+	xr_vector<u32>& partners0 = m_proxies[proxy0].partners;
+	xr_vector<u32>::iterator i = std::find(partners0.begin(), partners0.end(), proxy1);
+	if (i == partners0.end()) return;
+
+	*i = partners0.back();
+	partners0.pop_back();
+
+	xr_vector<u32>& partners1 = m_proxies[proxy1].partners;
+	i = std::find(partners1.begin(), partners1.end(), proxy0);
+	VERIFY(i != partners1.end());
+	*i = partners1.back();
+	partners1.pop_back();
+	++m_pairs_removed;
+}
+
+void CPHBroadphase::query(CPHObject* object, qResultVec& result)
+{
+	update();
+	result.clear_not_free();
+
+	u32 id = object->m_broadphase_id;
+	VERIFY(id != invalid_id);
+
+	const SProxy& proxy = m_proxies[id];
+	xr_vector<u32>::const_iterator i = proxy.partners.begin(), e = proxy.partners.end();
+	for (; e != i; ++i)
+	{
+		const SProxy& partner = m_proxies[*i];
+		if (overlap_yz(proxy, partner))
+			result.push_back(partner.object);
+	}
+}
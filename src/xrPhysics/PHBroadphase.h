@@ -0,0 +1,80 @@
+#ifndef PH_BROADPHASE_H
+#define PH_BROADPHASE_H
+#pragma once
+
+#include "PHObject.h"
+
+// Incremental sweep-and-prune over the boxes of all CPHObject registered for collision.
+// Endpoints are kept sorted along X between steps, so moving objects cost an insertion sort
+// over nearly sorted data, and the X-overlap pairs are kept as per-object partner lists which are
+// updated only when two endpoints swap. Queries filter the partners by Y and Z.
+class CPHBroadphase
+{
+	static const u32 invalid_id = u32(-1);
+	static const u32 max_flag = u32(1) << 31;
+
+	struct SEndpoint
+	{
+		float value;
+		u32 data; // proxy id, max_flag set for max endpoint
+
+		IC u32 proxy() const { return data & ~max_flag; }
+		IC bool is_max() const { return !!(data & max_flag); }
+
+		IC bool operator<(const SEndpoint& other) const
+		{
+			if (value != other.value) return value < other.value;
+			return !is_max() && other.is_max();
+		}
+	};
+
+	struct SProxy
+	{
+		CPHObject* object;
+		Fvector min;
+		Fvector max;
+		u32 endpoints[2]; // indices in m_endpoints
+		xr_vector<u32> partners; // proxies overlapping on X
+		bool moved;
+	};
+
+	xr_vector<SProxy> m_proxies;
+	xr_vector<u32> m_free;
+	xr_vector<SEndpoint> m_endpoints;
+	xr_vector<u32> m_moved;
+	u32 m_pairs_added;
+	u32 m_pairs_removed;
+
+	void fetch_bounds(SProxy& proxy);
+	void sort();
+	void on_swap(u32 proxy0, u32 proxy1);
+	void add_pair(u32 proxy0, u32 proxy1);
+	void remove_pair(u32 proxy0, u32 proxy1);
+	IC bool overlap_x(const SProxy& a, const SProxy& b) const
+	{
+		return a.min.x <= b.max.x && b.min.x <= a.max.x;
+	}
+
+	IC bool overlap_yz(const SProxy& a, const SProxy& b) const
+	{
+		return a.min.y <= b.max.y && b.min.y <= a.max.y && a.min.z <= b.max.z && b.min.z <= a.max.z;
+	}
+
+public:
+	CPHBroadphase();
+	~CPHBroadphase();
+
+	void add(CPHObject* object);
+	void remove(CPHObject* object);
+	void move(CPHObject* object);
+	void update();
+	void clear();
+
+	// fills result with objects whose boxes overlap the object's box
+	void query(CPHObject* object, qResultVec& result);
+
+	u32 pairs_added() const { return m_pairs_added; }
+	u32 pairs_removed() const { return m_pairs_removed; }
+};
+
+#endif // PH_BROADPHASE_H
@@ -17,9 +17,15 @@ CPHObject::CPHObject() : ISpatial(g_SpatialSpacePhysic)
 	spatial.type |= STYPE_PHYSIC;
 	m_island.Init();
 	m_check_count = 0;
+	m_broadphase_id = u32(-1);
 	CPHCollideValidator::InitObject(*this);
 }
 
+CPHObject::~CPHObject()
+{
+	if (ph_world) ph_world->Broadphase().remove(this);
+}
+
 void CPHObject::activate()
 {
 	R_ASSERT2(dSpacedGeom(), "trying to activate destroyed or not created object!");
@@ -80,6 +86,7 @@ void CPHObject::spatial_move()
 {
 	get_spatial_params();
 	ISpatial::spatial_move();
+	if (ph_world) ph_world->Broadphase().move(this);
 	m_flags.set(st_dirty,TRUE);
 }
 
@@ -134,8 +141,11 @@ extern u32 g_dead_body_collision;
 
 void CPHObject::CollideDynamics()
 {
-	g_SpatialSpacePhysic->q_box(ph_world->r_spatial, 0, STYPE_PHYSIC, spatial.sphere.P, AABB);
 	qResultVec& result = ph_world->r_spatial;
+	if (ph_console::ph_sap_broadphase && m_broadphase_id != u32(-1))
+		ph_world->Broadphase().query(this, result);
+	else
+		g_SpatialSpacePhysic->q_box(result, 0, STYPE_PHYSIC, spatial.sphere.P, AABB);
 	qResultIt i = result.begin(), e = result.end();
 	for (; i != e; ++i)
 	{
@@ -243,17 +253,26 @@ void CPHObject::spatial_register()
 {
 	get_spatial_params();
 	ISpatial::spatial_register();
+	if (ph_world) ph_world->Broadphase().add(this);
 	m_flags.set(st_dirty,TRUE);
 }
 
+void CPHObject::spatial_unregister()
+{
+	if (ph_world) ph_world->Broadphase().remove(this);
+	ISpatial::spatial_unregister();
+}
+
 void CPHObject::collision_disable()
 {
+	if (ph_world) ph_world->Broadphase().remove(this);
 	ISpatial::spatial_unregister();
 }
 
 void CPHObject::collision_enable()
 {
 	ISpatial::spatial_register();
+	if (ph_world) ph_world->Broadphase().add(this);
 }
 
 void CPHObject::Freeze()
@@ -24,6 +24,7 @@ class CPHObject :
 	friend struct SPHObjDBGDraw;
 #endif
 	DECLARE_PHLIST_ITEM(CPHObject)
+	friend class CPHBroadphase;
 
 	Flags8 m_flags;
 
@@ -42,6 +43,7 @@ class CPHObject :
 	CLBits m_collide_bits;
 	u8 m_check_count;
 	_flags<CLClassBits> m_collide_class_bits;
+	u32 m_broadphase_id;
 
 public:
 	enum ECastType
@@ -59,6 +61,7 @@ protected:
 	virtual dGeomID dSpacedGeom() =0;
 	virtual void get_spatial_params() =0;
 	virtual void spatial_register();
+	virtual void spatial_unregister();
 	void SetRayMotions() { m_flags.set(fl_ray_motions,TRUE); }
 	void UnsetRayMotions() { m_flags.set(fl_ray_motions,FALSE); }
 
@@ -105,6 +108,7 @@ public:
 
 
 	CPHObject();
+	virtual ~CPHObject();
 	void activate();
 	IC bool is_active() const { return !!m_flags.test(st_activated)/*b_activated*/; }
 	void deactivate();
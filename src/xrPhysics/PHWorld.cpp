@@ -23,6 +23,7 @@
 #include "../xrengine/defines.h"
 #include "../xrcdb/xr_area.h"
 #include "../xrcore/fs_internal.h"
+#include "../xrcore/xr_parallel.h"
 #ifdef	DEBUG
 //				void DBG_ObjAfterPhDataUpdate	( CPHObject *obj );
 //				void DBG_ObjBeforePhDataUpdate	( CPHObject *obj );
@@ -247,6 +248,7 @@ void CPHWorld::Create(bool mt, CObjectSpace* os, CObjectList* lo, CRenderDeviceB
 void CPHWorld::Destroy()
 {
 	r_spatial.clear();
+	m_broadphase.clear();
 	//xr_delete(m_commander);
 	Mesh.Destroy();
 #ifdef PH_PLAIN
@@ -290,6 +292,7 @@ void CPHWorld::OnFrame()
 	//DBG_DrawFrameStart();
 	//DBG_DrawStatBeforeFrameStep();
 #endif
+	TRACE_ZONE("physics");
 	Device().StatPhysics()->Physics.Begin();
 	FrameStep(Device().fTimeDelta);
 	Device().StatPhysics()->Physics.End();
@@ -305,6 +308,7 @@ static u32 start_time = 0;
 
 void CPHWorld::Step()
 {
+	TRACE_ZONE("physics_step");
 #ifdef DEBUG
 	debug_output().dbg_reused_queries_per_step()	=0			;
 	debug_output().dbg_new_queries_per_step()		=0			;
@@ -394,31 +398,7 @@ void CPHWorld::Step()
 	m_update_callback->update_step();
 	//	m_commander						->update();
 	//////////////////////////////////////////////////////////////////////
-	for (i_object = m_objects.begin(); m_objects.end() != i_object;)
-	{
-		CPHObject* obj = (*i_object);
-		++i_object;
-#ifdef DEBUG
-		if(debug_output().ph_dbg_draw_mask().test(phDbgDrawObjectStatistics))
-		{
-			if(obj->Island().IsActive())
-			{
-				debug_output().dbg_islands_num()++;
-				debug_output().dbg_joints_num()+=obj->Island().nj;
-				debug_output().dbg_bodies_num()+=obj->Island().nb;
-			}
-		}
-#endif
-
-#ifdef	DEBUG
-		debug_output().DBG_ObjBeforeStep( obj );
-#endif
-		obj->IslandStep(fixed_step);
-
-#ifdef	DEBUG
-		debug_output().DBG_ObjAfterStep( obj );
-#endif
-	}
+	StepIslands();
 
 	Device().StatPhysics()->ph_core.End();
 
@@ -465,6 +445,64 @@ void CPHWorld::Step()
 	};
 }
 
+// Islands are disjoint sets of bodies and joints once collision has merged them, and each one
+// is a separate dxWorld, so the active ones can be integrated concurrently. Collision stays serial:
+// NearCallback merges islands, allocates from the shared ContactGroup and calls back into game code.
+void CPHWorld::StepIslands()
+{
+	m_active_islands.clear_not_free();
+
+	PH_OBJECT_I i_object;
+	for (i_object = m_objects.begin(); m_objects.end() != i_object;)
+	{
+		CPHObject* obj = (*i_object);
+		++i_object;
+#ifdef DEBUG
+		if(debug_output().ph_dbg_draw_mask().test(phDbgDrawObjectStatistics))
+		{
+			if(obj->Island().IsActive())
+			{
+				debug_output().dbg_islands_num()++;
+				debug_output().dbg_joints_num()+=obj->Island().nj;
+				debug_output().dbg_bodies_num()+=obj->Island().nb;
+			}
+		}
+#endif
+
+#ifdef	DEBUG
+		debug_output().DBG_ObjBeforeStep( obj );
+#endif
+		if (obj->Island().IsActive())
+			m_active_islands.push_back(obj);
+	}
+
+	if (!ph_console::ph_parallel_islands || m_active_islands.size() < 2)
+	{
+		for (u32 i = 0, n = m_active_islands.size(); i < n; ++i)
+			m_active_islands[i]->IslandStep(fixed_step);
+	}
+	else
+	{
+		// quickstep shuffles constraints with dRandInt, its seed is per thread - give every island
+		// its own seed so the result does not depend on which worker picked it up
+		const u32 step_seed = u32(m_steps_num) * 2654435761u;
+		xr_parallel_for(0, m_active_islands.size(), [&](u32 i)
+		{
+			dRandSetSeed(step_seed + i);
+			m_active_islands[i]->IslandStep(fixed_step);
+		});
+	}
+
+#ifdef	DEBUG
+	for (i_object = m_objects.begin(); m_objects.end() != i_object;)
+	{
+		CPHObject* obj = (*i_object);
+		++i_object;
+		debug_output().DBG_ObjAfterStep( obj );
+	}
+#endif
+}
+
 void CPHWorld::StepTouch()
 {
 	PH_OBJECT_I i_object;
@@ -6,6 +6,7 @@
 #include <boost/noncopyable.hpp>
 #include "physics_scripted.h"
 #include "../xrEngine/pure.h"
+#include "PHBroadphase.h"
 // refs
 struct SGameMtlPair;
 //class	CPHCommander;
@@ -62,12 +63,15 @@ class CPHWorld : public pureFrame,
 	CObjectSpace* m_object_space;
 	CObjectList* m_level_objects;
 	CRenderDeviceBase* m_device; ;
+	xr_vector<CPHObject*> m_active_islands; // owners of islands stepped this step
+	CPHBroadphase m_broadphase;
 public:
 	xr_vector<ISpatial*> r_spatial;
 public:
 	u64 m_steps_num;
 private:
 	u16 m_steps_short_num;
+	void StepIslands();
 public:
 	double m_frame_sum;
 	dReal m_previous_frame_time;
@@ -121,6 +125,7 @@ public:
 	u16 UpdateObjectsNumber();
 	IC u16 StepsShortCnt() { return m_steps_short_num; }
 	u64& StepsNum() { return m_steps_num; }
+	CPHBroadphase& Broadphase() { return m_broadphase; }
 	float FrameTime() { return m_frame_time; }
 	ContactCallbackFun* default_contact_shotmark() { return m_default_contact_shotmark; }
 	ContactCallbackFun* default_character_contact_shotmark() { return m_default_character_contact_shotmark; }
@@ -11,3 +11,5 @@ float ph_console::phBreakCommonFactor = 0.01f;
 float ph_console::phRigidBreakWeaponFactor = 1.f;
 
 float ph_console::ph_step_time = fixed_step;
+BOOL ph_console::ph_parallel_islands = 1;
+BOOL ph_console::ph_sap_broadphase = 1;
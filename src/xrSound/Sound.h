@@ -39,6 +39,10 @@ XRSOUND_API extern float psSoundVMusic;
 XRSOUND_API extern float psSoundVMusicFactor;
 XRSOUND_API extern float psSoundRolloff;
 XRSOUND_API extern float psSoundOcclusionScale;
+XRSOUND_API extern int psSoundOcclusionBudget;
+XRSOUND_API extern float psSoundOcclusionMoveThreshold;
+XRSOUND_API extern int psSoundOcclusionMaxAge;
+XRSOUND_API extern float psSoundOcclusionSmooth;
 XRSOUND_API extern Flags32 psSoundFlags;
 XRSOUND_API extern int psSoundTargets;
 XRSOUND_API extern float psSpeedOfSound;
@@ -313,6 +317,7 @@ public:
 	u32 _cache_hits;
 	u32 _cache_misses;
 	u32 _events;
+	u32 _occlusion_rays;
 };
 
 class XRSOUND_API CSound_stats_ext
@@ -11,6 +11,10 @@ int psSoundTargets = 256;
 Flags32 psSoundFlags = {ss_Hardware | ss_EAX};
 float psSoundOcclusionScale = 0.5f;
 float psSoundCull = 0.01f;
+int psSoundOcclusionBudget = 16;
+float psSoundOcclusionMoveThreshold = 0.5f;
+int psSoundOcclusionMaxAge = 30;
+float psSoundOcclusionSmooth = 1.f;
 float psSoundRolloff = 0.75f;
 u32 psSoundModel = 0;
 float psSoundVEffects = 1.0f;
@@ -36,6 +40,7 @@ CSoundRender_Core::CSoundRender_Core()
 	Handler = NULL;
 	s_targets_pu = 0;
 	s_emitters_u = 0;
+	s_occlusion_rays = 0;
 	e_current.set_identity();
 	e_target.set_identity();
 	bListenerMoved = FALSE;
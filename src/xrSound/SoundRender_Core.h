@@ -48,6 +48,8 @@ protected:
 	xr_vector<CSoundRender_Target*> s_targets;
 	xr_vector<CSoundRender_Target*> s_targets_defer;
 	u32 s_targets_pu; // parameters update
+	xr_vector<CSoundRender_Emitter*> s_occlusion_queue; // emitters waiting for occlusion refresh
+	u32 s_occlusion_rays; // rays cast during last update
 	SoundEnvironment_LIB* s_environment;
 	CSoundRender_Environment s_user_environment;
 
@@ -123,6 +125,8 @@ public:
 
 	virtual float get_occlusion_to(const Fvector& hear_pt, const Fvector& snd_pt, float dispersion = 0.2f);
 	float get_occlusion(Fvector& P, float R, Fvector* occ) override;
+	void update_occlusion(const Fvector& listener);
+	void i_update_occlusion(CSoundRender_Emitter* E, const Fvector& listener);
 	CSoundRender_Environment* get_environment(const Fvector& P);
 
 	void env_load();
@@ -0,0 +1,72 @@
+#include "stdafx.h"
+#pragma hdrstop
+
+#include "SoundRender_Core.h"
+#include "SoundRender_Emitter.h"
+
+// Occlusion of every audible emitter used to be ray-tested from update_culling() each frame.
+// Now emitters keep the last measured value, and the core refreshes at most psSoundOcclusionBudget
+// of them per update, stalest first, out of those that moved (or whose listener moved) past the
+// threshold or outlived psSoundOcclusionMaxAge updates. Emitter FSM lerps occluder_volume towards
+// the cached value, so the lower refresh rate is not audible.
+
+struct occlusion_pred
+{
+	u32 frame;
+
+	occlusion_pred(u32 _frame) : frame(_frame)
+	{
+	}
+
+	IC u32 age(const CSoundRender_Emitter* E) const
+	{
+		return E->occ_valid ? frame - E->occ_frame : u32(-1);
+	}
+
+	IC bool operator()(const CSoundRender_Emitter* A, const CSoundRender_Emitter* B) const
+	{
+		return age(A) > age(B);
+	}
+};
+
+void CSoundRender_Core::i_update_occlusion(CSoundRender_Emitter* E, const Fvector& listener)
+{
+	E->occ_value = get_occlusion(E->p_source.position, .2f, E->occluder);
+	E->occ_emitter_pos.set(E->p_source.position);
+	E->occ_listener_pos.set(listener);
+	E->occ_frame = s_emitters_u;
+	E->occ_valid = TRUE;
+	s_occlusion_rays++;
+}
+
+void CSoundRender_Core::update_occlusion(const Fvector& listener)
+{
+	s_occlusion_rays = 0;
+	s_occlusion_queue.clear_not_free();
+
+	const float move_sqr = _sqr(psSoundOcclusionMoveThreshold);
+	const u32 max_age = (u32)psSoundOcclusionMaxAge;
+
+	for (u32 it = 0; it < s_emitters.size(); it++)
+	{
+		CSoundRender_Emitter* E = s_emitters[it];
+		if (!E->need_occlusion()) continue;
+
+		if (!E->occ_valid
+			|| (s_emitters_u - E->occ_frame) >= max_age
+			|| E->occ_emitter_pos.distance_to_sqr(E->p_source.position) > move_sqr
+			|| E->occ_listener_pos.distance_to_sqr(listener) > move_sqr)
+			s_occlusion_queue.push_back(E);
+	}
+
+	if (s_occlusion_queue.empty()) return;
+
+	// Stalest first; invalid entries always win
+	u32 count = _min((u32)s_occlusion_queue.size(), (u32)psSoundOcclusionBudget);
+	if (count < s_occlusion_queue.size())
+		std::partial_sort(s_occlusion_queue.begin(), s_occlusion_queue.begin() + count, s_occlusion_queue.end(),
+		                  occlusion_pred(s_emitters_u));
+
+	for (u32 it = 0; it < count; it++)
+		i_update_occlusion(s_occlusion_queue[it], listener);
+}
@@ -31,6 +31,9 @@ void CSoundRender_Core::update(const Fvector& P, const Fvector& D, const Fvector
 
 	s_emitters_u ++;
 
+	// Refresh a budgeted subset of cached emitter occlusions
+	update_occlusion(listener_position());
+
 	// Firstly update emitters, which are now being rendered
 	//Msg	("! update: r-emitters");
 	for (it = 0; it < s_targets.size(); it++)
@@ -160,6 +163,7 @@ void CSoundRender_Core::statistic(CSound_stats* dest, CSound_stats_ext* ext)
 		dest->_cache_hits = cache._stat_hit;
 		dest->_cache_misses = cache._stat_miss;
 		dest->_events = g_saved_event_count;
+		dest->_occlusion_rays = s_occlusion_rays;
 		cache.stats_clear();
 	}
 	if (ext)
@@ -34,6 +34,11 @@ CSoundRender_Emitter::CSoundRender_Emitter(void)
 	occluder[0].set(0, 0, 0);
 	occluder[1].set(0, 0, 0);
 	occluder[2].set(0, 0, 0);
+	occ_emitter_pos.set(0, 0, 0);
+	occ_listener_pos.set(0, 0, 0);
+	occ_value = 1.f;
+	occ_frame = 0;
+	occ_valid = FALSE;
 	m_current_state = stStopped;
 	set_cursor(0);
 	bMoved = TRUE;
@@ -47,6 +47,13 @@ public:
 	float fade_volume;
 	Fvector occluder [3];
 
+	// cached occlusion, refreshed by CSoundRender_Core::update_occlusion
+	Fvector occ_emitter_pos; // emitter position at last ray test
+	Fvector occ_listener_pos; // listener position at last ray test
+	float occ_value; // last measured occlusion
+	u32 occ_frame; // s_emitters_u at last ray test
+	BOOL occ_valid;
+
 	State m_current_state;
 	u32 m_stream_cursor;
 	u32 m_cur_handle_cursor;
@@ -112,6 +119,7 @@ public:
 	void cancel(); // manager forces out of rendering
 	void update(float dt);
 	BOOL update_culling(float dt);
+	BOOL need_occlusion();
 	void update_environment(float dt);
 	void rewind();
 	virtual void stop(BOOL bDeffered);
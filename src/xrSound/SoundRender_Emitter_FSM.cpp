@@ -12,6 +12,7 @@
 #endif
 
 XRSOUND_API extern float psSoundCull;
+XRSOUND_API extern float psSoundOcclusionSmooth;
 
 inline u32 calc_cursor(const float& fTimeStarted, float& fTime, const float& fTimeTotal, const WAVEFORMATEX& wfx)
 {
@@ -65,7 +66,8 @@ void CSoundRender_Emitter::update(float dt)
 		fTimeToStop = fTime + (get_length_sec() / psSpeedOfSound); 
 		fTimeToPropagade = fTime;
 		fade_volume = 1.f;
-		occluder_volume = SoundRender->get_occlusion(p_source.position, .2f, occluder);
+		SoundRender->i_update_occlusion(this, SoundRender->listener_position());
+		occluder_volume = occ_value;
 		smooth_volume = p_source.base_volume * p_source.volume * (owner_data->s_type == st_Effect
 			                                                          ? psSoundVEffects * psSoundVFactor
 			                                                          : psSoundVMusic * psSoundVMusicFactor) * (b2D ? 1.f : occluder_volume);
@@ -91,7 +93,8 @@ void CSoundRender_Emitter::update(float dt)
 		fTimeToStop = 0xffffffff;
 		fTimeToPropagade = fTime;
 		fade_volume = 1.f;
-		occluder_volume = SoundRender->get_occlusion(p_source.position, .2f, occluder);
+		SoundRender->i_update_occlusion(this, SoundRender->listener_position());
+		occluder_volume = occ_value;
 		smooth_volume = p_source.base_volume * p_source.volume * (owner_data->s_type == st_Effect
 			                                                          ? psSoundVEffects * psSoundVFactor
 			                                                          : psSoundVMusic * psSoundVMusicFactor) * (b2D ? 1.f : occluder_volume);
@@ -303,11 +306,9 @@ BOOL CSoundRender_Emitter::update_culling(float dt)
 			                   : 1.f;
 		fade_volume += dt * 10.f * fade_scale;
 
-		// Update occlusion
-		float occ = (owner_data->g_type == SOUND_TYPE_WORLD_AMBIENT)
-			            ? 1.0f
-			            : SoundRender->get_occlusion(p_source.position, .2f, occluder);
-		volume_lerp(occluder_volume, occ, 1.f, dt);
+		// Update occlusion (rays are cast in budgeted batches by the core, see update_occlusion)
+		float occ = (owner_data->g_type == SOUND_TYPE_WORLD_AMBIENT) ? 1.0f : occ_value;
+		volume_lerp(occluder_volume, occ, psSoundOcclusionSmooth, dt);
 		clamp(occluder_volume, 0.f, 1.f);
 	}
 	clamp(fade_volume, 0.f, 1.f);
@@ -323,6 +324,14 @@ BOOL CSoundRender_Emitter::update_culling(float dt)
 	else return SoundRender->i_allow_play(this);
 }
 
+BOOL CSoundRender_Emitter::need_occlusion()
+{
+	if (b2D || !owner_data || owner_data->g_type == SOUND_TYPE_WORLD_AMBIENT) return FALSE;
+	if (m_current_state != stPlaying && m_current_state != stPlayingLooped) return FALSE;
+	if (iPaused) return FALSE;
+	return SoundRender->listener_position().distance_to_sqr(p_source.position) <= _sqr(p_source.max_distance);
+}
+
 float CSoundRender_Emitter::priority()
 {
 	float dist = SoundRender->listener_position().distance_to(p_source.position);
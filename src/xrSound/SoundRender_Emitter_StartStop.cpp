@@ -32,6 +32,7 @@ void CSoundRender_Emitter::start(ref_sound* _owner, BOOL _loop, float delay)
 	}
 	bStopping = FALSE;
 	bRewind = FALSE;
+	occ_valid = FALSE;
 }
 
 void CSoundRender_Emitter::i_stop()
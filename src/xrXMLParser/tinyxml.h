@@ -1005,6 +1005,13 @@ public:
 		return result;
 	}
 
+	/// Append an attribute, used to restore a parsed document. The name must be unique.
+	void LinkEndAttribute(const char* _name, const char* _value)
+	{
+		TiXmlAttribute* attrib = xr_new<TiXmlAttribute>(_name, _value);
+		attributeSet.Add(attrib);
+	}
+
 	const TiXmlAttribute* FirstAttribute() const { return attributeSet.First(); }
 	///< Access the first attribute in this element.
 	TiXmlAttribute* FirstAttribute() { return attributeSet.First(); }
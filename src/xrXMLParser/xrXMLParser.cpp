@@ -3,12 +3,13 @@
 
 #include "xrXMLParser.h"
 
-extern void XMLLuaCallback(CXml &m_xml, LPCSTR xml_string);
+extern bool XMLLuaCallback(CXml &m_xml, LPCSTR xml_string);
 
 XRXMLPARSER_API CXml::CXml()
 	: m_root(NULL),
 	  m_pLocalRoot(NULL)
 {
+	m_xml_file_name[0] = 0;
 }
 
 XRXMLPARSER_API CXml::~CXml()
@@ -131,29 +132,18 @@ void CXml::Load(LPCSTR path, LPCSTR xml_filename)
 	W.w_stringZ("");
 	FS.r_close(F);
 
-	m_Doc.Parse(&m_Doc, (LPCSTR)W.pointer());
-	if (m_Doc.Error())
-	{
-		string1024 str;
-		xr_sprintf(str, "XML file:%s value:%s errDescr:%s", m_xml_file_name, m_Doc.Value(), m_Doc.ErrorDesc());
-		R_ASSERT2(false, str);
-	}
+	// the script may hand back its own version of the text, then the original one is not needed
+	if (XMLLuaCallback(*this, (LPCSTR)W.pointer()))
+		return;
 
+	ParseText((LPCSTR)W.pointer(), W.size() - 1);
 	m_root = m_Doc.FirstChildElement();
-	XMLLuaCallback(*this, (LPCSTR)W.pointer());
 }
 
 void CXml::LoadFromString(LPCSTR xml_string)
 {
 	ClearInternal();
-	m_Doc.Parse(&m_Doc, xml_string);
-	if (m_Doc.Error())
-	{
-		string1024 str;
-		xr_sprintf(str, "XML file:%s value:%s errDescr:%s", m_xml_file_name, m_Doc.Value(), m_Doc.ErrorDesc());
-		R_ASSERT2(false, str);
-	}
-
+	ParseText(xml_string, xr_strlen(xml_string));
 	m_root = m_Doc.FirstChildElement();
 }
 
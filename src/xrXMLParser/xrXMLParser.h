@@ -102,6 +102,13 @@ private:
 
 	typedef TiXmlElement XML_ELEM;
 	TiXmlDocument m_Doc;
+
+	// Binary copy of the parsed document in $app_data_root$, keyed by the crc of the text
+	// after includes and script edits, so unchanged files skip TinyXML parsing
+	void ParseText(LPCSTR text, u32 length);
+	void CacheName(string_path& result) const;
+	bool LoadCache(LPCSTR file_name, u32 crc, u32 length);
+	void SaveCache(LPCSTR file_name, u32 crc, u32 length);
 };
 
 #endif //xrXMLParserH
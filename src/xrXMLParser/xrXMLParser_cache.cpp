@@ -0,0 +1,214 @@
+#include "stdafx.h"
+#pragma hdrstop
+
+#include "xrXMLParser.h"
+
+// Parsed documents are stored as a flat pre-order list of nodes next to the text crc and length,
+// one slot per file. A slot whose crc does not match the current text is overwritten after the
+// next parse, so edited or modded files never read stale data. -no_xml_cache disables it.
+
+static const u32 xml_cache_magic = MAKEFOURCC('X', 'M', 'L', 'C');
+static const u32 xml_cache_version = 1;
+
+// files smaller than this parse faster than their cache is checked
+static const u32 xml_cache_min_length = 4 * 1024;
+
+static void save_node(IWriter& W, const TiXmlNode* node)
+{
+	W.w_u8(u8(node->Type()));
+
+	switch (node->Type())
+	{
+	case TiXmlNode::ELEMENT:
+		{
+			W.w_stringZ(node->Value());
+
+			const TiXmlElement* element = node->ToElement();
+			u32 attribute_count = 0;
+			for (const TiXmlAttribute* attrib = element->FirstAttribute(); attrib; attrib = attrib->Next())
+				++attribute_count;
+
+			W.w_u32(attribute_count);
+			for (const TiXmlAttribute* attrib = element->FirstAttribute(); attrib; attrib = attrib->Next())
+			{
+				W.w_stringZ(attrib->Name());
+				W.w_stringZ(attrib->Value());
+			}
+		}
+		break;
+	case TiXmlNode::TEXT:
+		W.w_u8(node->ToText()->CDATA() ? 1 : 0);
+		W.w_stringZ(node->Value());
+		break;
+	case TiXmlNode::DECLARATION:
+		{
+			const TiXmlDeclaration* declaration = node->ToDeclaration();
+			W.w_stringZ(declaration->Version());
+			W.w_stringZ(declaration->Encoding());
+			W.w_stringZ(declaration->Standalone());
+		}
+		break;
+	default:
+		W.w_stringZ(node->Value());
+		break;
+	}
+
+	u32 child_count = 0;
+	for (const TiXmlNode* child = node->FirstChild(); child; child = child->NextSibling())
+		++child_count;
+
+	W.w_u32(child_count);
+	for (const TiXmlNode* child = node->FirstChild(); child; child = child->NextSibling())
+		save_node(W, child);
+}
+
+IC LPCSTR read_string(IReader& F)
+{
+	LPCSTR result = (LPCSTR)F.pointer();
+	F.advance(xr_strlen(result) + 1);
+	return result;
+}
+
+static TiXmlNode* load_node(IReader& F)
+{
+	TiXmlNode* node;
+
+	switch (F.r_u8())
+	{
+	case TiXmlNode::ELEMENT:
+		{
+			TiXmlElement* element = xr_new<TiXmlElement>(read_string(F));
+			for (u32 i = 0, n = F.r_u32(); i < n; ++i)
+			{
+				LPCSTR name = read_string(F);
+				element->LinkEndAttribute(name, read_string(F));
+			}
+			node = element;
+		}
+		break;
+	case TiXmlNode::TEXT:
+		{
+			bool cdata = !!F.r_u8();
+			TiXmlText* text = xr_new<TiXmlText>(read_string(F));
+			text->SetCDATA(cdata);
+			node = text;
+		}
+		break;
+	case TiXmlNode::COMMENT:
+		node = xr_new<TiXmlComment>(read_string(F));
+		break;
+	case TiXmlNode::DECLARATION:
+		{
+			LPCSTR version = read_string(F);
+			LPCSTR encoding = read_string(F);
+			node = xr_new<TiXmlDeclaration>(version, encoding, read_string(F));
+		}
+		break;
+	default:
+		node = xr_new<TiXmlUnknown>();
+		node->SetValue(read_string(F));
+		break;
+	}
+
+	for (u32 i = 0, n = F.r_u32(); i < n; ++i)
+		node->LinkEndChild(load_node(F));
+
+	return node;
+}
+
+void CXml::CacheName(string_path& result) const
+{
+	string_path full_name;
+	xr_strcpy(full_name, m_xml_file_name);
+	xr_strlwr(full_name);
+
+	string_path file_name;
+	_splitpath(m_xml_file_name, 0, 0, file_name, 0);
+
+	string_path name;
+	xr_sprintf(name, "xml_cache\\%s_%08x.xmlc", file_name, path_crc32(full_name, xr_strlen(full_name)));
+	FS.update_path(result, "$app_data_root$", name);
+}
+
+bool CXml::LoadCache(LPCSTR file_name, u32 crc, u32 length)
+{
+	if (!FS.exist(file_name))
+		return false;
+
+	IReader* F = FS.r_open(file_name);
+	if (!F)
+		return false;
+
+	// the magic is repeated at the end, a slot cut short by a crash never matches
+	bool result = F->length() > int(5 * sizeof(u32));
+	if (result)
+	{
+		F->seek(F->length() - int(sizeof(u32)));
+		result = (F->r_u32() == xml_cache_magic);
+		F->seek(0);
+	}
+
+	result = result
+		&& F->r_u32() == xml_cache_magic
+		&& F->r_u32() == xml_cache_version
+		&& F->r_u32() == crc
+		&& F->r_u32() == length;
+
+	if (result)
+	{
+		// same as TiXmlDocument::Parse, nodes are appended to the document
+		for (u32 i = 0, n = F->r_u32(); i < n; ++i)
+			m_Doc.LinkEndChild(load_node(*F));
+	}
+
+	FS.r_close(F);
+	return result;
+}
+
+void CXml::SaveCache(LPCSTR file_name, u32 crc, u32 length)
+{
+	CMemoryWriter W;
+	W.w_u32(xml_cache_magic);
+	W.w_u32(xml_cache_version);
+	W.w_u32(crc);
+	W.w_u32(length);
+
+	u32 child_count = 0;
+	for (const TiXmlNode* child = m_Doc.FirstChild(); child; child = child->NextSibling())
+		++child_count;
+
+	W.w_u32(child_count);
+	for (const TiXmlNode* child = m_Doc.FirstChild(); child; child = child->NextSibling())
+		save_node(W, child);
+
+	W.w_u32(xml_cache_magic);
+	W.save_to(file_name);
+}
+
+void CXml::ParseText(LPCSTR text, u32 length)
+{
+	// strings built by scripts have no file name and are not cached
+	bool use_cache = length >= xml_cache_min_length && m_xml_file_name[0] && !m_Doc.FirstChild() &&
+		FS.path_exist("$app_data_root$") && !strstr(Core.Params, "-no_xml_cache");
+
+	string_path cache_name;
+	u32 crc = 0;
+	if (use_cache)
+	{
+		CacheName(cache_name);
+		crc = crc32(text, length);
+		if (LoadCache(cache_name, crc, length))
+			return;
+	}
+
+	m_Doc.Parse(&m_Doc, text);
+	if (m_Doc.Error())
+	{
+		string1024 str;
+		xr_sprintf(str, "XML file:%s value:%s errDescr:%s", m_xml_file_name, m_Doc.Value(), m_Doc.ErrorDesc());
+		R_ASSERT2(false, str);
+	}
+
+	if (use_cache)
+		SaveCache(cache_name, crc, length);
+}